@@ -0,0 +1,99 @@
+/*
+    Smoggle - A multidimensional and multi-language boggle solver
+    Copyright (C) 2009 - Nicolas Lermé <nicolas.lerme@free.fr>
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef __ALPHABET_H__
+#define __ALPHABET_H__
+
+#include <string>
+#include <vector>
+#include <map>
+#include <cassert>
+#include "types.h"
+#include "language_config.h"
+
+
+//------------------------------------------------------------------------------------------------------------
+// Maps each character of a language to a dense identifier in [0, Size()[. Characters which do not belong to 
+// the language are mapped to NONE. Identifiers are small enough to be used as bit positions in a 32-bit mask, 
+// the bit NONE being never set.
+//
+// The alphabet also holds a table of tiles, which are the strings a grid cell may hold (a letter of the config
+// may be made of several characters, such as "qu"). A tile is identified by its index in this table and is
+// stored as the identifiers of its characters, so that a grid is translated once into tile identifiers.
+//------------------------------------------------------------------------------------------------------------
+class CAlphabet
+{
+     public :
+	typedef uchar TLetterId;
+	//------ Identifiers ------
+	typedef std::vector<TLetterId>         TLetterIdsList;
+	typedef TLetterIdsList::const_iterator TLetterIdsListCIt;
+	typedef TLetterIdsList::iterator       TLetterIdsListIt;
+	//-------- Counts ---------
+	typedef std::vector<uint>                 TLetterCountsList;
+	typedef TLetterCountsList::const_iterator TLetterCountsListCIt;
+	typedef TLetterCountsList::iterator       TLetterCountsListIt;
+	//--------- Tiles ---------
+	typedef uchar TTileId;
+	typedef std::vector<TLetterIdsList>       TTilesList;
+	typedef TTilesList::const_iterator        TTilesListCIt;
+	typedef std::map<TWordType, TTileId>      TTileIdsMap;
+	typedef TTileIdsMap::const_iterator       TTileIdsMapCIt;
+
+	static const TLetterId NONE = 31;
+	static const uint MAX_TILES = 256;
+
+     private :
+	std::string m_Letters;
+	TLetterId m_Ids[256];
+	TTilesList m_Tiles;
+	TTileIdsMap m_TileIds;
+
+	void _Init( const std::string & letters );
+
+     public :
+	CAlphabet();
+	CAlphabet( const std::string & letters );
+	CAlphabet( const CLanguageConfig & language_config );
+	CAlphabet( const TLanguageConfigsList & language_configs );
+	~CAlphabet();
+	const std::string & Letters() const;
+	const uint Size() const;
+	const bool Translate( const TWordType & word, TLetterIdsList & ids ) const;
+	TTileId AddTile( const TWordType & tile );
+	const TTilesList & Tiles() const;
+
+	TLetterId Id( const char letter ) const
+	{
+		return m_Ids[uchar(letter)];
+	}
+
+	char Letter( const TLetterId id ) const
+	{
+		return m_Letters[id];
+	}
+
+	const TLetterIdsList & Tile( const TTileId tile ) const
+	{
+		assert(tile < m_Tiles.size());
+		return m_Tiles[tile];
+	}
+};
+
+#endif //__ALPHABET_H__
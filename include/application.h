@@ -48,14 +48,14 @@ class CApplication
 	typedef std::map<uint,uint>              TWordsLengthsMap;
 	typedef TWordsLengthsMap::const_iterator TWordsLengthsMapCIt;
 
-	std::string m_Language, m_InputGridFilename, m_OutputGridFilename;
+	std::string m_Language, m_InputGridFilename, m_OutputGridFilename, m_DictionaryFilename, m_ImageFilename;
 	uint m_GridDim, m_GridSize, m_MinWordLength, m_MaxWordLength;
 	CLexicographicTree m_Tree;
 	CGrid m_Grid;
-	CLanguageConfig m_LanguageConfig;
+	TLanguageConfigsList m_LanguageConfigs;
 	TWordsLengthsMap m_WordsLengths;
 	TWordsList m_WordsFound;
-	bool m_PeriodicBorders;
+	bool m_PeriodicBorders, m_Dawg, m_GridPruning, m_Succinct, m_Stats;
 	std::string m_SolvingMode;
 
      public :
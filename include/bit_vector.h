@@ -0,0 +1,106 @@
+/*
+    Smoggle - A multidimensional and multi-language boggle solver
+    Copyright (C) 2009 - Nicolas Lermé <nicolas.lerme@free.fr>
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef __BIT_VECTOR_H__
+#define __BIT_VECTOR_H__
+
+#include <vector>
+#include <cassert>
+#include "types.h"
+#include "utils.h"
+
+
+//------------------------------------------------------------------------------------------------------------
+// Static sequence of bits answering rank (number of ones before a position) and select (position of the k-th
+// one or zero) queries. Bits are first appended, then Build computes the directories: the number of ones before
+// each superblock of 512 bits, and the superblock of every 512th one and zero, from which select scans forward.
+//------------------------------------------------------------------------------------------------------------
+class CBitVector
+{
+     public :
+	//------ Words ------
+	typedef std::vector<ullong>        TWordsList;
+	typedef TWordsList::const_iterator TWordsListCIt;
+	//------ Counts ------
+	typedef std::vector<uint>           TCountsList;
+	typedef TCountsList::const_iterator TCountsListCIt;
+
+	static const uint WORD_SIZE       = 64;
+	static const uint SUPERBLOCK_SIZE = 512;
+
+     protected :
+	TWordsList m_Words;
+	TCountsList m_Ranks, m_Selects[2];
+	uint m_Size, m_NbOnes;
+
+	const uint _Select( const bool bit, const uint k ) const;
+
+     public :
+	CBitVector();
+	~CBitVector();
+	void PushBack( const bool bit );
+	void Build();
+	void Clear();
+	const uint & Size() const;
+	const uint & NbOfOnes() const;
+	const size_t Bytes() const;
+
+	bool operator [] ( const uint k ) const
+	{
+		assert(k < m_Size);
+		return ((m_Words[k / WORD_SIZE] >> (k % WORD_SIZE)) & 1);
+	}
+
+	// Number of ones in [0, k[
+	uint Rank1( const uint k ) const
+	{
+		const uint word(k / WORD_SIZE), superblock(k / SUPERBLOCK_SIZE), bits(k % WORD_SIZE);
+		uint rank(m_Ranks[superblock]);
+
+
+		assert(k <= m_Size);
+
+		for( uint w=superblock*(SUPERBLOCK_SIZE/WORD_SIZE); w<word; w++ )
+			rank += PopCount(m_Words[w]);
+
+		if( bits != 0 )
+			rank += PopCount(m_Words[word] & ((ullong(1) << bits) - 1));
+
+		return rank;
+	}
+
+	uint Rank0( const uint k ) const
+	{
+		return (k - Rank1(k));
+	}
+
+	// Position of the k-th one (starting from 0)
+	uint Select1( const uint k ) const
+	{
+		return _Select(true, k);
+	}
+
+	// Position of the k-th zero (starting from 0)
+	uint Select0( const uint k ) const
+	{
+		return _Select(false, k);
+	}
+};
+
+#endif //__BIT_VECTOR_H__
@@ -29,6 +29,11 @@
 #include "types.h"
 
 
+//------------------------------------------------------------------------------------------------------------
+// Coordinates of any dimension. Coordinates of at most MAX_INLINE_DIM components, which covers all the grids of the 
+// command line, are stored in the object itself: they are built, copied and stored in lists without allocating 
+// memory. Larger ones are allocated on the heap.
+//------------------------------------------------------------------------------------------------------------
 class CCoords
 {
      public :
@@ -36,26 +41,29 @@ class CCoords
 	typedef Type* Iterator;
 	typedef const Type* ConstIterator;
 
+	static const uint MAX_INLINE_DIM = 4;
+
      protected :
 	uint m_Dim;
 	Type *m_Data;
+	Type m_Buffer[MAX_INLINE_DIM];
 
      public :
 	//---------- Creation, destruction & copy operators ----------
-	CCoords( const uint dim = 1 ) : m_Dim(0), m_Data(NULL)
+	CCoords( const uint dim = 1 ) : m_Dim(0), m_Data(m_Buffer)
 	{
 		Resize(dim);
 		Fill(Type());
 	}
 
-	CCoords( const Type x, const Type y ) : m_Dim(0), m_Data(NULL)
+	CCoords( const Type x, const Type y ) : m_Dim(0), m_Data(m_Buffer)
 	{
 		Resize(2);
 		m_Data[0] = x;
 		m_Data[1] = y;
 	}
 
-	CCoords( const Type x, const Type y, const Type z ) : m_Dim(0), m_Data(NULL)
+	CCoords( const Type x, const Type y, const Type z ) : m_Dim(0), m_Data(m_Buffer)
 	{
 		Resize(3);
 		m_Data[0] = x;
@@ -63,7 +71,7 @@ class CCoords
 		m_Data[2] = z;
 	}
 
-	CCoords( const Type* data, const uint dim ) : m_Dim(0), m_Data(NULL)
+	CCoords( const Type* data, const uint dim ) : m_Dim(0), m_Data(m_Buffer)
 	{
 		Resize(dim);
 
@@ -71,7 +79,7 @@ class CCoords
 			m_Data[k] = data[k];
 	}
 
-	CCoords( const uint dim, const Type value ) : m_Dim(0), m_Data(NULL)
+	CCoords( const uint dim, const Type value ) : m_Dim(0), m_Data(m_Buffer)
 	{
 		Resize(dim);
 		Fill(value);
@@ -79,11 +87,11 @@ class CCoords
 
 	~CCoords()
 	{
-		if( m_Data != NULL )
+		if( m_Data != m_Buffer )
 			delete [] m_Data, m_Data=NULL;
 	}
 
-	CCoords( const CCoords & other ) : m_Dim(0), m_Data(NULL)
+	CCoords( const CCoords & other ) : m_Dim(0), m_Data(m_Buffer)
 	{
 		Resize(other.Dim());
 
@@ -101,6 +109,30 @@ class CCoords
 		return *this;
 	}
 
+#if __cplusplus >= 201103L
+	// Components allocated on the heap are taken from a temporary instead of being copied
+	CCoords( CCoords && other ) : m_Dim(0), m_Data(m_Buffer)
+	{
+		*this = static_cast<CCoords&&>(other);
+	}
+
+	CCoords & operator = ( CCoords && other )
+	{
+		if( other.m_Data == other.m_Buffer )
+			return (*this = static_cast<const CCoords&>(other));
+
+		if( m_Data != m_Buffer )
+			delete [] m_Data;
+
+		m_Dim        = other.m_Dim;
+		m_Data       = other.m_Data;
+		other.m_Dim  = 0;
+		other.m_Data = other.m_Buffer;
+
+		return *this;
+	}
+#endif
+
 	//-------------------- Access operators --------------------
 	Type operator [] ( const uint k ) const
 	{
@@ -313,11 +345,11 @@ class CCoords
 	{
 		if( m_Dim != dim )
 		{
-			if( m_Data != NULL )
+			if( m_Data != m_Buffer )
 				delete [] m_Data;
 
-			m_Data = new Type[dim];
-			m_Dim = dim;
+			m_Data = (dim <= MAX_INLINE_DIM ? m_Buffer : new Type[dim]);
+			m_Dim  = dim;
 		}
 	}
 
@@ -333,8 +365,28 @@ class CCoords
 
 	static float Curvature( const CCoords & prev, const CCoords & p, const CCoords & next )
 	{
-		CCoords u(p-prev), v(p-next);
-		return float((u+v).Magnitude()) / (u.Magnitude() * v.Magnitude());
+		assert(prev.Dim() == p.Dim() && next.Dim() == p.Dim());
+		return Curvature<0>(prev.m_Data, p.m_Data, next.m_Data, p.m_Dim);
+	}
+
+	// Same as above, from the components of the coordinates. The solver calls it at each step, so the dimension is given 
+	// at compile time when Dim is not null, which lets the compiler unroll the loop.
+	template<uint Dim> static float Curvature( const Type *prev, const Type *p, const Type *next, const uint dim = Dim )
+	{
+		Type u_mag(0), v_mag(0), w_mag(0);
+
+
+		// We compute the magnitudes of u=p-prev, v=p-next and u+v in place
+		for( uint k=0; k<(Dim ? Dim : dim); k++ )
+		{
+			const Type u(p[k] - prev[k]), v(p[k] - next[k]);
+
+			u_mag += u * u;
+			v_mag += v * v;
+			w_mag += (u + v) * (u + v);
+		}
+
+		return float(w_mag) / (u_mag * v_mag);
 	}
 };
 
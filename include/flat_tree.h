@@ -0,0 +1,260 @@
+/*
+    Smoggle - A multidimensional and multi-language boggle solver
+    Copyright (C) 2009 - Nicolas Lermé <nicolas.lerme@free.fr>
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef __FLAT_TREE_H__
+#define __FLAT_TREE_H__
+
+#include <vector>
+#include <map>
+#include <ostream>
+#include <cassert>
+#include "types.h"
+#include "utils.h"
+#include "node.h"
+#include "alphabet.h"
+
+
+//------------------------------------------------------------------------------------------------------------
+// Frozen version of a lexicographic tree. All nodes are stored in a single array and the children of a node
+// are contiguous, so that a node is only an index in this array. The root is always the node 0. When the tree
+// is built from a minimized automaton (DAWG), several nodes may point to the same block of children. Since
+// links are not pointers, the array can also be written as is in a file and used later from a read-only
+// memory mapping of this file.
+//
+// Values are identifiers of an alphabet. Each node holds a mask of the letters of its children, which are
+// sorted by identifier: the child of letter k is found by counting the bits set before the bit k.
+//
+// Words are numbered in the order of a depth-first traversal. Each node holds the number of words under its
+// previous siblings, so that the identifier of a word is computed while going down the tree, by adding these
+// numbers and the terminal nodes met. Since they only depend on the nodes of the path, identifiers are the same
+// in a pruned copy, and the numbers of a block shared in a DAWG are valid for all its parents.
+//
+// A tree may hold the words of several languages: each node then holds the mask of the languages in which the
+// word ending there exists. A node is terminal when this mask is not empty.
+//
+// Each node also holds the minimum and maximum numbers of letters to add to its word to reach a word of the tree,
+// so that the solver gives up a branch whose words cannot have a correct length. These lengths are computed with
+// the ranks, and saturate at MAX_LENGTH. Likewise, each node holds the mask of the letters needed by all the words
+// under it: a branch is given up when one of them is not available anymore in the grid.
+//
+// A flat tree can also be built as a pruned copy of another one, keeping only the words which can be spelled
+// with a given multiset of letters (typically, the letters of a grid).
+//
+// A tile of several letters is compiled into a table giving, for each node, the node reached by following all
+// its letters and the words met on the way, so that a grid cell holding this tile is a single step in the tree.
+// These tables are built again after any change of the nodes or of their ranks.
+//
+// Words can be inserted or erased in place as long as blocks are not shared and the nodes are owned. Since a
+// block must stay contiguous, adding a child moves the block at the end of the array, and removing one shifts
+// its next siblings. Unreachable nodes are counted and the array is compacted when they are too many.
+//------------------------------------------------------------------------------------------------------------
+class CFlatTree
+{
+     public :
+	typedef uint TIndex;
+	typedef CAlphabet::TLetterId TLetterId;
+	typedef uchar TLanguagesMask;
+
+	struct CFlatNode
+	{
+		uint children;
+		TIndex first_child;
+		uint rank;
+		uint letters;
+		TLetterId value;
+		TLanguagesMask languages;
+		uchar min_length, max_length;
+	};
+
+	//------ Nodes ------
+	typedef std::vector<CFlatNode>         TFlatNodesList;
+	typedef TFlatNodesList::const_iterator TFlatNodesListCIt;
+	typedef TFlatNodesList::iterator       TFlatNodesListIt;
+
+	//------ Indexes ------
+	typedef std::vector<TIndex>          TIndexesList;
+	typedef TIndexesList::const_iterator TIndexesListCIt;
+	typedef TIndexesList::iterator       TIndexesListIt;
+
+	struct CTransition
+	{
+		TIndex node;
+		uint word_id;
+	};
+
+	//---- Transitions ----
+	typedef std::vector<CTransition>          TTransitionsList;
+	typedef TTransitionsList::const_iterator  TTransitionsListCIt;
+	typedef std::vector<TTransitionsList>     TTransitionsTable;
+	typedef TTransitionsTable::const_iterator TTransitionsTableCIt;
+
+	//------ Blocks ------
+	typedef std::map<TNodeChar::TNodesList, TIndex> TBlocksMap;
+	typedef TBlocksMap::const_iterator              TBlocksMapCIt;
+
+	static const TIndex NIL = TIndex(-1);
+	static const uint MAX_LANGUAGES = 8;
+	static const TLanguagesMask ALL_LANGUAGES = TLanguagesMask(-1);
+	static const uint MAX_LENGTH = 255;
+	static const uint NO_MAX_LENGTH = uint(-1) >> 1;
+
+     protected :
+	TFlatNodesList m_Nodes;
+	const CFlatNode *m_Data;
+	TTransitionsTable m_Transitions;
+	uint m_NbNodes, m_NbGarbageNodes, m_NbWords;
+	bool m_SharedChildren, m_Ranked;
+
+	void _Build( const TNodeChar *node, const TIndex index, const CAlphabet & alphabet, const uint nb_languages, TBlocksMap *blocks );
+	TIndex _Prune( const CFlatTree & tree, const TIndex node, CAlphabet::TLetterCountsList & counts, uint & children );
+	void _Copy( const CFlatTree & tree, const TIndex node, const TIndex index );
+	const uint _Rank( const TIndex node, TIndexesList & counts );
+	void _Bound( const TIndex node, std::vector<bool> & done );
+	TIndex _AddChild( const TIndex node, const TLetterId value );
+	void _RemoveChild( const TIndex node, const TLetterId value );
+	void _Compact();
+	void _Update();
+
+     public :
+	CFlatTree();
+	~CFlatTree();
+	void Build( const TNodeChar *root, const CAlphabet & alphabet, const uint nb_nodes = 0, const bool share_children = false, const uint nb_languages = 1 );
+	void Prune( const CFlatTree & tree, const CAlphabet::TLetterCountsList & counts );
+	void Attach( const void *data, const uint nb_nodes, const uint nb_words );
+	bool Save( std::ostream & out ) const;
+	bool Insert( const CAlphabet::TLetterIdsList & word, const TLanguagesMask languages = 1 );
+	bool Erase( const CAlphabet::TLetterIdsList & word, const TLanguagesMask languages = ALL_LANGUAGES );
+	const bool IsEditable() const;
+	void Rank();
+	const bool & IsRanked() const;
+	void Compile( const CAlphabet::TTilesList & tiles );
+	bool Word( uint word_id, CAlphabet::TLetterIdsList & word ) const;
+	void Clear();
+	const uint NbOfNodes() const;
+	const uint & NbOfWords() const;
+	const size_t Bytes() const;
+	const size_t ResidentBytes() const;
+
+	TIndex Root() const
+	{
+		return 0;
+	}
+
+	TLetterId Value( const TIndex node ) const
+	{
+		assert(node < m_NbNodes);
+		return m_Data[node].value;
+	}
+
+	bool IsTerminal( const TIndex node ) const
+	{
+		assert(node < m_NbNodes);
+		return (m_Data[node].languages != 0);
+	}
+
+	TLanguagesMask Languages( const TIndex node ) const
+	{
+		assert(node < m_NbNodes);
+		return m_Data[node].languages;
+	}
+
+	uint Letters( const TIndex node ) const
+	{
+		assert(node < m_NbNodes);
+		return m_Data[node].letters;
+	}
+
+	uint MinLength( const TIndex node ) const
+	{
+		assert(node < m_NbNodes);
+		return m_Data[node].min_length;
+	}
+
+	// A saturated maximum length is only a lower bound, so it does not bound anything
+	uint MaxLength( const TIndex node ) const
+	{
+		assert(node < m_NbNodes);
+		return (m_Data[node].max_length < MAX_LENGTH ? m_Data[node].max_length : NO_MAX_LENGTH);
+	}
+
+	TIndex FirstChild( const TIndex node ) const
+	{
+		assert(node < m_NbNodes);
+		return m_Data[node].first_child;
+	}
+
+	TIndex NbOfChildren( const TIndex node ) const
+	{
+		assert(node < m_NbNodes);
+		return PopCount(m_Data[node].children);
+	}
+
+	TIndex Child( const TIndex node, const TLetterId value ) const
+	{
+		assert(node < m_NbNodes && value <= CAlphabet::NONE);
+		const uint bit(1u << value), children(m_Data[node].children);
+
+		if( !(children & bit) )
+			return NIL;
+
+		return (m_Data[node].first_child + PopCount(children & (bit - 1)));
+	}
+
+	TIndex Child( const TIndex node, const TLetterId value, uint & word_id ) const
+	{
+		const TIndex child(Child(node, value));
+
+		if( child != NIL )
+			word_id += (m_Data[node].languages != 0) + m_Data[child].rank;
+
+		return child;
+	}
+
+	TIndex ChildWord( TIndex node, const CAlphabet::TLetterIdsList & word ) const
+	{
+		for( uint k=0; k<word.size() && node != NIL; k++ )
+			node = Child(node, word[k]);
+
+		return node;
+	}
+
+	TIndex ChildWord( TIndex node, const CAlphabet::TLetterIdsList & word, uint & word_id ) const
+	{
+		for( uint k=0; k<word.size() && node != NIL; k++ )
+			node = Child(node, word[k], word_id);
+
+		return node;
+	}
+
+	TIndex ChildTile( const TIndex node, const CAlphabet::TTileId tile, const CAlphabet::TLetterIdsList & letters, uint & word_id ) const
+	{
+		assert(tile < m_Transitions.size());
+
+		// Tiles of a single letter are not compiled
+		if( m_Transitions[tile].empty() )
+			return ChildWord(node, letters, word_id);
+
+		const CTransition & transition(m_Transitions[tile][node]);
+		word_id += transition.word_id;
+
+		return transition.node;
+	}
+};
+
+#endif //__FLAT_TREE_H__
@@ -21,11 +21,14 @@
 #define __GRID_H__
 
 #include <vector>
+#include <algorithm>
 #include <cassert>
 #include <iostream>
+#include <stdexcept>
 #include "types.h"
 #include "utils.h"
 #include "coords.h"
+#include "smart_ptr.h"
 #include "language_config.h"
 
 using std::cout;
@@ -36,14 +39,19 @@ using std::flush;
 class CGrid
 {
      public :
+	//------- Tiles ------
+	typedef uchar TTileId;
 	//------- Grid -------
-	typedef std::vector<TWordType>    TGridData;
+	typedef std::vector<TTileId>      TGridData;
 	typedef TGridData::iterator       TGridDataIt;
 	typedef TGridData::const_iterator TGridDataCIt;
 	//------ Coords ------
 	typedef std::vector<CCoords>        TCoordsList;
 	typedef TCoordsList::const_iterator TCoordsListCIt;
 	typedef TCoordsList::iterator       TCoordsListIt;
+	//------ Cells -------
+	typedef std::vector<uint>          TCellsList;
+	typedef TCellsList::const_iterator TCellsListCIt;
 	//------ Letters ------
 	typedef CLanguageConfig::TLettersList    TLettersList;
 	typedef CLanguageConfig::TLettersListCIt TLettersListCIt;
@@ -53,18 +61,59 @@ class CGrid
 	typedef CLanguageConfig::TWeightsListCIt TWeightsListCIt;
 	typedef CLanguageConfig::TWeightsListIt  TWeightsListIt;
 
+	//------------------------------------------------------------------------------------------------------------
+	// Neighbors of all the cells, identified by their offsets, in CSR form: the neighbors of the cell k are the 
+	// cells neighbors[offsets[k]] to neighbors[offsets[k+1]-1], in increasing order. They only depend on the sizes 
+	// of the grid, so they are computed once and shared by the copies of a grid. A grid of at most MAX_MASK_CELLS 
+	// cells also gets the neighbors of each cell as a mask of bits.
+	//------------------------------------------------------------------------------------------------------------
+	struct CAdjacency
+	{
+		TCellsList offsets, neighbors;
+		std::vector<ullong> masks;
+	};
+
+	static const uint MAX_MASK_CELLS = 64;
+	static const uint MAX_TILES      = 256;
+
      protected :
+	//------------------------------------------------------------------------------------------------------------
+	// Cells hold the identifiers of their letters in a table of tiles, which is the list of the letters of the 
+	// language config for a generated grid. Copying a grid thus copies one byte per cell, while the table is shared 
+	// by the copies. It is never modified once it is shared: a new letter gives a new table.
+	//------------------------------------------------------------------------------------------------------------
 	uint m_Dim;
-	CCoords m_Sizes;
+	CCoords m_Sizes, m_Strides;
 	TGridData m_GridData;
+	smart_ptr<TLettersList> m_Tiles;
+	mutable smart_ptr<CAdjacency> m_Adjacencies[2];
 
 	void _Init()
 	{
-		std::fill(m_GridData.begin(), m_GridData.end(), TWordType());
+		m_Tiles = new TLettersList(1, TWordType());
+		std::fill(m_GridData.begin(), m_GridData.end(), 0);
+	}
+
+	TTileId _Tile( const TWordType & letter )
+	{
+		const TLettersListCIt it(std::find(m_Tiles->begin(), m_Tiles->end(), letter));
+
+
+		if( it != m_Tiles->end() )
+			return TTileId(it - m_Tiles->begin());
+
+		if( m_Tiles->size() >= MAX_TILES )
+			throw std::logic_error("a grid cannot hold more than " + ToString(uint(MAX_TILES)) + " different letters");
+
+		smart_ptr<TLettersList> tiles(new TLettersList(*m_Tiles));
+		tiles->push_back(letter);
+		m_Tiles = tiles;
+
+		return TTileId(m_Tiles->size() - 1);
 	}
 
      public :
-	CGrid() : m_Dim(0), m_Sizes(0, 0){}
+	CGrid() : m_Dim(0), m_Sizes(0, 0), m_Tiles(new TLettersList(1, TWordType())){}
 
 	CGrid( const uint dim, const uint size ) : m_Dim(dim), m_Sizes(dim, size)
 	{
@@ -94,13 +143,32 @@ class CGrid
 		return p;
 	}
 
+	const uint RandomCell() const
+	{
+		return Min(Random<uint>(0, TotalSize()), TotalSize()-1);
+	}
+
 	CGrid SubGrid( const CCoords & offset, const CCoords & sizes ) const
 	{
 		assert(offset.Dim() == sizes.Dim() && offset.Dim() == m_Dim);
 		CGrid grid(m_Dim, sizes[0]);
+		const int origin(Offset(offset));
+
+
+		// The cells of the sub-grid are browsed by offset, and their offsets in the grid are obtained with its strides. The 
+		// sub-grid shares the table of tiles of the grid.
+		grid.m_Tiles = m_Tiles;
+
+		for( uint k=0; k<grid.TotalSize(); k++ )
+		{
+			const CCoords c(grid.Coords(k));
+			int o(origin);
 
-		for( CCoordsIterator p=grid.Begin(); p!=grid.End(); ++p )
-			grid(*p) = operator () (*p + offset);
+			for( uint d=0; d<m_Dim; d++ )
+				o += c[d] * m_Strides[d];
+
+			grid.m_GridData[k] = m_GridData[o];
+		}
 
 		return grid;
 	}
@@ -126,6 +194,37 @@ class CGrid
 		return result;
 	}
 
+	// Same as above, for a cell given by its offset. The neighbors are also given by their offsets, which are obtained 
+	// from the one of the cell with the strides of the grid.
+	TCellsList NegativeHalfNeighbors( const uint cell, const uint neighborhood_radius ) const
+	{
+		assert(cell < TotalSize() && neighborhood_radius > 0);
+
+		TCellsList result;
+		const CCoords c(Coords(cell));
+		CCoordsIterator it(CCoords(m_Dim, -int(neighborhood_radius)), CCoords(m_Dim, 0)), end(m_Dim);
+
+
+		while( it != end )
+		{
+			const CCoords delta(*it);
+
+			if( !(delta == 0) && (c + delta) >= 0 )
+			{
+				int o(cell);
+
+				for( uint d=0; d<m_Dim; d++ )
+					o += delta[d] * m_Strides[d];
+
+				result.push_back(o);
+			}
+
+			it++;
+		}
+
+		return result;
+	}
+
 	TCoordsList PositiveHalfNeighbors( const CCoords & c, const uint neighborhood_radius ) const
 	{
 		assert(c.Dim() == m_Dim && neighborhood_radius > 0);
@@ -180,16 +279,13 @@ class CGrid
 		{
 			neighbor = (*it - CCoords(m_Dim, neighborhood_radius) + c);
 
-			if( neighbor != c )
-			{
-				for( uint k=0; k<m_Dim; k++ )
-				{
-					if( neighbor[k] < 0 )           neighbor[k] = -neighbor[k];
-					if( neighbor[k] >= m_Sizes[k] ) neighbor[k] = (neighbor[k] % m_Sizes[k]);
-				}
+			// Coordinates wrap around the borders. On a small grid, several offsets may lead to the same neighbor, which is 
+			// only given once.
+			for( uint k=0; k<m_Dim; k++ )
+				neighbor[k] = ((neighbor[k] % m_Sizes[k]) + m_Sizes[k]) % m_Sizes[k];
 
+			if( neighbor != c && std::find(result.begin(), result.end(), neighbor) == result.end() )
 				result.push_back(neighbor);
-			}
 
 			it++;
 		}
@@ -197,6 +293,42 @@ class CGrid
 		return result;
 	}
 
+	const CAdjacency & Adjacency( const bool periodic ) const
+	{
+		smart_ptr<CAdjacency> & adjacency(m_Adjacencies[periodic ? 1 : 0]);
+
+
+		if( !adjacency )
+		{
+			adjacency = new CAdjacency;
+			adjacency->offsets.reserve(TotalSize()+1);
+			adjacency->offsets.push_back(0);
+
+			for( uint k=0; k<TotalSize(); k++ )
+			{
+				const TCoordsList neighbors(periodic ? PeriodicNeighbors(Coords(k), 1) : Neighbors(Coords(k), 1));
+
+				for( TCoordsListCIt it=neighbors.begin(); it!=neighbors.end(); it++ )
+					adjacency->neighbors.push_back(Offset(*it));
+
+				// Wrapped neighbors come out of order
+				std::sort(adjacency->neighbors.begin() + adjacency->offsets.back(), adjacency->neighbors.end());
+				adjacency->offsets.push_back(adjacency->neighbors.size());
+			}
+
+			if( TotalSize() <= MAX_MASK_CELLS )
+			{
+				adjacency->masks.assign(TotalSize(), 0);
+
+				for( uint k=0; k<TotalSize(); k++ )
+					for( uint j=adjacency->offsets[k]; j<adjacency->offsets[k+1]; j++ )
+						adjacency->masks[k] |= (ullong(1) << adjacency->neighbors[j]);
+			}
+		}
+
+		return *adjacency;
+	}
+
 	void Resize( const CCoords & sizes )
 	{
 		assert(sizes > 0);
@@ -204,45 +336,93 @@ class CGrid
 		m_Sizes    = sizes;
 		m_GridData = TGridData(m_Sizes.Product());
 
+		// The offset of a cell is the sum of its coordinates weighted by the strides. The first coordinate varies the fastest.
+		m_Strides = CCoords(m_Sizes.Dim(), 1);
+
+		for( uint d=1; d<m_Sizes.Dim(); d++ )
+			m_Strides[d] = m_Strides[d-1] * m_Sizes[d-1];
+
+		// The neighbors of the previous sizes are not valid anymore
+		m_Adjacencies[0] = smart_ptr<CAdjacency>();
+		m_Adjacencies[1] = smart_ptr<CAdjacency>();
+
 		_Init();
 	}
 
 	int Offset( const CCoords & c ) const
 	{
-		assert(m_Dim == c.Dim());
+		int o(0);
 
-		int o = c[m_Dim - 1];
-		assert(o >= 0 && o < m_Sizes[m_Dim - 1]);
 
-		for( int d=(m_Dim - 2); d>=0; d-- )
+		assert(m_Dim == c.Dim());
+
+		for( uint d=0; d<m_Dim; d++ )
 		{
 			assert(c[d] >= 0 && c[d] < m_Sizes[d]);
-			o = o * m_Sizes[d] + c[d];
+			o += c[d] * m_Strides[d];
 		}
 
 		return o;
 	}
 
-	TWordType operator () ( const uint k ) const
+	const CCoords & Strides() const
 	{
-		assert(k <= uint(Offset(m_Sizes-1)));
-		return m_GridData[k];
+		return m_Strides;
 	}
 
-	TWordType & operator () ( const uint k )
+	CCoords Coords( uint offset ) const
 	{
-		assert(k <= uint(Offset(m_Sizes-1)));
+		CCoords c(m_Dim);
+
+		assert(offset < TotalSize());
+
+		for( uint d=0; d<m_Dim; d++ )
+		{
+			c[d]    = offset % m_Sizes[d];
+			offset /= m_Sizes[d];
+		}
+
+		return c;
+	}
+
+	const TWordType & operator () ( const uint k ) const
+	{
+		assert(k < m_GridData.size());
+		return (*m_Tiles)[m_GridData[k]];
+	}
+
+	const TWordType & operator () ( const CCoords & c ) const
+	{
+		return (*m_Tiles)[m_GridData[Offset(c)]];
+	}
+
+	void Letter( const uint k, const TWordType & letter )
+	{
+		assert(k < m_GridData.size());
+		m_GridData[k] = _Tile(letter);
+	}
+
+	void Letter( const CCoords & c, const TWordType & letter )
+	{
+		Letter(Offset(c), letter);
+	}
+
+	const TTileId & Tile( const uint k ) const
+	{
+		assert(k < m_GridData.size());
 		return m_GridData[k];
 	}
 
-	TWordType operator () ( const CCoords & c ) const
+	// The identifier must come from the table of this grid, or from the one of a copy
+	void Tile( const uint k, const TTileId tile )
 	{
-		return m_GridData[Offset(c)];
+		assert(k < m_GridData.size() && tile < m_Tiles->size());
+		m_GridData[k] = tile;
 	}
 
-	TWordType & operator () ( const CCoords & c )
+	const TLettersList & Tiles() const
 	{
-		return m_GridData[Offset(c)];
+		return *m_Tiles;
 	}
 
 	void Print( const uint gap = 2 )
@@ -310,13 +490,19 @@ class CGrid
 	void Generate( const CLanguageConfig & language_config )
 	{
 		TGridDataIt it_grid_data(m_GridData.begin());
-		TLettersList letters(language_config.Letters());
+		const TLettersList & letters(language_config.Letters());
 		TWeightsList weights(language_config.Weights());
 		TWeightsListCIt it_weights(weights.begin());
 		uint cumul(0), k(1), letters_size(letters.size());
 		TWeightsList cumul_weights(letters_size+1);
 
 
+		if( letters_size > MAX_TILES )
+			throw std::logic_error("a grid cannot hold more than " + ToString(uint(MAX_TILES)) + " different letters");
+
+		// The identifiers of the letters of the grid are their indexes in the config
+		m_Tiles = new TLettersList(letters);
+
 		cumul_weights[0] = 0;
 
 		while( it_weights < weights.end() )
@@ -339,14 +525,14 @@ class CGrid
 				if( n >= cumul_weights[middle] ) lb = middle;
 			}
 
-			*it_grid_data = letters[lb];
+			*it_grid_data = TTileId(lb);
 			it_grid_data++;
 		}
 	}
 
 	const uint TotalSize() const
 	{
-		return m_Sizes.Product();
+		return m_GridData.size();
 	}
 
 	const uint Size() const
@@ -361,9 +547,13 @@ class CGrid
 
 	void Swap( const CCoords & c1, const CCoords & c2 )
 	{
-		TWordType w = (*this)(c1);
-		(*this)(c1) = (*this)(c2);
-		(*this)(c2) = w;
+		Swap(Offset(c1), Offset(c2));
+	}
+
+	void Swap( const uint k1, const uint k2 )
+	{
+		assert(k1 < m_GridData.size() && k2 < m_GridData.size());
+		std::swap(m_GridData[k1], m_GridData[k2]);
 	}
 
 	void Shuffle()
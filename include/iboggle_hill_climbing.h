@@ -24,10 +24,11 @@
 #include "iboggle.h"
 
 
+// Swap of two cells, given by their offsets
 struct CSwap
 {
-	CCoords c1, c2;
-	CSwap( const CCoords & _c1 = CCoords(), const CCoords & _c2 = CCoords() ) : c1(_c1), c2(_c2){}
+	uint c1, c2;
+	CSwap( const uint _c1 = 0, const uint _c2 = 0 ) : c1(_c1), c2(_c2){}
 };
 
 class CIBoggleHillClimbing : public IIBoggle
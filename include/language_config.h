@@ -41,6 +41,8 @@ class CLanguageConfig
 	TWeightsList m_Weights;
 	std::string m_Language;
 	std::string m_DictionaryFilename;
+	std::string m_StrippedCharacters;
+	bool m_CaseFolding;
 
      public :
 	CLanguageConfig();
@@ -51,8 +53,17 @@ class CLanguageConfig
 	void DictionaryFilename( const std::string & dict_filename );
 	const std::string & Language() const;
 	void Language( const std::string & language );
+	void CaseFolding( const bool case_folding );
+	const bool & CaseFolding() const;
+	void StrippedCharacters( const std::string & stripped_characters );
+	const std::string & StrippedCharacters() const;
 	void AddLetter( const TWordType & letter, const uint weight );
 	const bool IsConsistent() const;
 };
 
+//------ Languages ------
+typedef std::vector<CLanguageConfig>         TLanguageConfigsList;
+typedef TLanguageConfigsList::const_iterator TLanguageConfigsListCIt;
+typedef TLanguageConfigsList::iterator       TLanguageConfigsListIt;
+
 #endif //__LANGUAGE_CONFIG_H__
@@ -24,10 +24,24 @@
 #include <fstream>
 #include <omp.h>
 #include <set>
+#include <map>
 #include "grid.h"
 #include "types.h"
 #include "tree.h"
+#include "flat_tree.h"
+#include "succinct_tree.h"
+#include "tree_stats.h"
+#include "alphabet.h"
 #include "path.h"
+#include "mapped_file.h"
+#include "pool.h"
+
+#define IMAGE_EXTENSION std::string("img")
+#define IMAGE_MAGIC     "SMOGGLE"
+#define IMAGE_VERSION   6
+#define NB_SHARDS       256
+#define MAX_SPLIT_DEPTH 3
+#define UNITS_PER_THREAD 16
 
 
 class CLexicographicTree : public TTreeChar
@@ -41,144 +55,643 @@ class CLexicographicTree : public TTreeChar
 	typedef std::set<TWordType>         TWordsList;
 	typedef TWordsList::const_iterator  TWordsListCIt;
 	typedef TWordsList::iterator        TWordsListIt;
+	//----- Word ids -----
+	typedef std::vector<uint>            TWordIdsList;
+	typedef TWordIdsList::const_iterator TWordIdsListCIt;
+	typedef TWordIdsList::iterator       TWordIdsListIt;
 	//----- Coords ------
 	typedef CGrid::TCoordsList          TCoordsList;
 	typedef TCoordsList::const_iterator TCoordsListCIt;
 	typedef TCoordsList::iterator       TCoordsListIt;
+	//---- Components ----
+	typedef std::vector<CCoords::Type> TComponentsList;
+	//------ Cells ------
+	typedef CGrid::TCellsList    TCellsList;
+	typedef CGrid::TCellsListCIt TCellsListCIt;
+	//------ Tiles ------
+	typedef std::vector<CAlphabet::TTileId> TTilesGrid;
 	//------ Paths ------
 	typedef std::vector<CPath>         TPathsList;
 	typedef TPathsList::const_iterator TPathsListCIt;
 	typedef TPathsList::iterator       TPathsListIt;
+	//---- Dictionary ----
+	typedef std::vector<TWordType>       TDictionary;
+	typedef TDictionary::const_iterator  TDictionaryCIt;
+	typedef TDictionary::iterator        TDictionaryIt;
+	// Word found in the grid, given by its identifier in the tree, with the mean curvature of its path
+	struct CFoundWord
+	{
+		uint id, length;
+		float curvature;
+	};
+
+	//--- Found words ----
+	typedef std::vector<CFoundWord>         TFoundWordsList;
+	typedef TFoundWordsList::const_iterator TFoundWordsListCIt;
+	typedef TFoundWordsList::iterator       TFoundWordsListIt;
+	//--- Found words by unit of work ---
+	typedef std::vector<TFoundWordsList> TFoundWordsTable;
+
+	// Cell of the path followed in the grid, with the node reached in the tree, the next neighbors to browse (see the sets 
+	// of cells below) and the sum of the curvatures of the previous cells
+	template<typename Tree> struct CStep
+	{
+		typename Tree::TIndex node;
+		uint cell, word_id, word_length;
+		ullong next;
+		float curvature;
+	};
+
+	// Cells of a grid of any size: the visited cells are marked in a bitset and the neighbors are browsed in the adjacency 
+	// lists, from the index given by First
+	struct CCellsList
+	{
+		const CGrid::CAdjacency *adjacency;
+		std::vector<bool> visited;
+
+		void Init( const CGrid::CAdjacency & grid_adjacency, const uint nb_cells )
+		{
+			adjacency = &grid_adjacency;
+			visited.assign(nb_cells, false);
+		}
+
+		ullong First( const uint cell ) const
+		{
+			return adjacency->offsets[cell];
+		}
+
+		const bool Next( const uint cell, ullong & next, uint & neighbor ) const
+		{
+			while( next < adjacency->offsets[cell+1] )
+				if( !visited[neighbor = adjacency->neighbors[next++]] )
+					return true;
+
+			return false;
+		}
+
+		void Mark( const uint cell )
+		{
+			visited[cell] = true;
+		}
+
+		void Unmark( const uint cell )
+		{
+			visited[cell] = false;
+		}
+	};
+
+	// Cells of a grid of at most 64 cells: the visited cells and the neighbors of a cell are masks of bits. First gives the 
+	// neighbors which are free when the cell is entered. The cells visited below are free again when the next neighbor 
+	// is taken, so it is taken from this mask, by increasing offset as in the adjacency lists.
+	struct CCellsMask
+	{
+		const CGrid::CAdjacency *adjacency;
+		ullong visited;
+
+		void Init( const CGrid::CAdjacency & grid_adjacency, const uint nb_cells )
+		{
+			assert(nb_cells <= CGrid::MAX_MASK_CELLS && grid_adjacency.masks.size() == nb_cells);
+			adjacency = &grid_adjacency;
+			visited   = 0;
+		}
+
+		ullong First( const uint cell ) const
+		{
+			return (adjacency->masks[cell] & ~visited);
+		}
+
+		const bool Next( const uint cell, ullong & next, uint & neighbor ) const
+		{
+			if( next == 0 )
+				return false;
+
+			neighbor = LowestBit(next);
+			next    &= next - 1;
+
+			return true;
+		}
+
+		void Mark( const uint cell )
+		{
+			visited |= (ullong(1) << cell);
+		}
+
+		void Unmark( const uint cell )
+		{
+			visited &= ~(ullong(1) << cell);
+		}
+	};
+
+	// Units of work of a resolution: the paths of at most 'depth' cells of the grid in CSR form, in depth-first order. The 
+	// shortest paths only give the words they spell, while the longest ones are browsed further.
+	struct CWorkUnits
+	{
+		TCellsList offsets, cells;
+		uint depth;
+	};
+
+	//------------------------------------------------------------------------------------------------------------
+	// State of a depth-first traversal of the grid: the current path, the visited cells and the letters of the free 
+	// cells. The coordinates of the cells are kept as components, one row of Dimension() components per cell. The 
+	// dimension of the grid is a template parameter for the usual ones (2 to 4), so that the computation of the 
+	// curvatures is fixed-size, and is null for the others, whose dimension is only known at run time.
+	//------------------------------------------------------------------------------------------------------------
+	template<typename Tree, typename Cells, uint Dim> struct CTraversal
+	{
+		std::vector<CStep<Tree> > path;
+		Cells cells;
+		CAlphabet::TLetterCountsList remaining;
+		uint available, dim;
+		const CCoords::Type *components;
+
+		uint Dimension() const
+		{
+			return (Dim ? Dim : dim);
+		}
+
+		const CCoords::Type* Components( const uint cell ) const
+		{
+			return (components + cell * Dimension());
+		}
+	};
+	//----- Register -----
+	typedef std::set<TNodeChar*, CNodeLess<char> > TRegister;
+	typedef TRegister::const_iterator             TRegisterCIt;
+	typedef TRegister::iterator                   TRegisterIt;
+	//----- Pool -----
+	typedef CPool<TNodeChar> TNodesPool;
+	//------ Merge -------
+	typedef std::map<TNodeChar*, TNodeChar*> TNodesMap;
+	typedef TNodesMap::const_iterator        TNodesMapCIt;
+
+	// Words sharing the same first character, inserted in their own sub-tree by a single thread
+	struct CShard
+	{
+		TNodeChar *root;
+		TDictionary words;
+		TNodesList last_nodes;
+		TWordType last_word;
+		TRegister nodes;
+		TNodesPool pool;
+		bool normalized;
+
+		CShard() : root(NULL), normalized(false){}
+	};
+
+	//------ Shards ------
+	typedef std::vector<CShard>         TShardsList;
+	typedef TShardsList::const_iterator TShardsListCIt;
+	typedef TShardsList::iterator       TShardsListIt;
+
+	// Header of a compiled dictionary (image), directly followed by the nodes of the flat tree
+	struct CImageHeader
+	{
+		char magic[8];
+		uint version, node_size, nb_nodes, nb_words, min_word_length, max_word_length, alphabet_size, nb_languages;
+		char alphabet[32];
+	};
 
      protected :
-	TNodesList m_LastNodes;
-	TWordType m_LastWord;
-	uint m_MinWordLength, m_MaxWordLength;
+	TRegister m_Register;
+	TNodesPool m_Pool;
+	TWordIdsList m_WordIds;
+	std::vector<uint> m_FoundWords;
+	CFlatTree m_FlatTree, m_View;
+	CSuccinctTree m_SuccinctTree;
+	CAlphabet::TLetterCountsList m_ViewCounts;
+	CAlphabet m_Alphabet;
+	TLanguageConfigsList m_LanguageConfigs;
+	std::vector<CAlphabet> m_LanguageAlphabets;
+	CMappedFile m_Image;
+	uint m_MinWordLength, m_MaxWordLength, m_NbLanguages, m_MaxTileLength;
+	CFlatTree::TLanguagesMask m_Languages;
 	int m_Score;
 	float m_MeanCurvature;
-	bool m_PeriodicBorders;
+	bool m_PeriodicBorders, m_Minimize, m_GridPruning, m_Succinct;
 	TPathsList m_Paths;
 
-	void _InsertNode( TNodeChar *node, const TWordType & word, const uint position );
-	void _SaveWords( std::ofstream & fp, const TNodeChar *node, const TWordType & word ) const;
-	const uint _GetNumberOfWords( TNodeChar *node ) const;
-	TNodeChar* _ChildrenWord( TNodeChar* node, const TWordType & word, const uint position ) const;
-
-	void _Solve( const CGrid & grid, 
-		     const CCoords & p, 
-		     TNodeChar * node, 
-		     const TWordType & word, 
-		     const CPath & path, 
-		     TCoordsList visited_nodes, 
-		     TWordsList & words, 
-		     TPathsList & paths ) const
-	{
-		TCoordsList neighbors;
-		TCoordsListCIt it_coords;
-		TNodeChar* children(NULL);
-		TWordType new_word;
-		uint new_word_length;
-		CPath new_path(path);
-
-
-		// We continue only if the current node has a correct children in the grid
-		if( (children = _ChildrenWord(node, grid(p), 0)) != NULL )
-		{
-			new_word        = word + grid(p);
-			new_word_length = new_word.size();
-			new_path.AddNode(p);
-
-			// If the current node is terminal, we have found a word. Then we add it to the current list if it has a correct length
-			if( children->IsTerminal() && new_word_length >= m_MinWordLength && new_word_length <= m_MaxWordLength )
+	void _InsertNode( CShard & shard, TNodeChar *node, const TWordType & word, const uint position );
+	void _ReplaceOrRegister( CShard & shard, const uint depth );
+	void _BuildShard( CShard & shard );
+	TNodeChar* _Merge( TNodeChar *node, TNodesMap & merged_nodes );
+	void _JoinShards( TShardsList & shards );
+	void _ReleaseNodes();
+	template<typename Tree> void _Stats( const Tree & tree, const typename Tree::TIndex node, const uint depth, CTreeStats & stats ) const;
+	template<typename Tree> void _Stats( const Tree & tree, CTreeStats & stats ) const;
+	template<typename Tree> void _SaveWords( std::ofstream & fp, const Tree & tree, const typename Tree::TIndex node, const TWordType & word ) const;
+	const uint _GetNumberOfWords( const CFlatTree::TIndex node ) const;
+	void _Freeze();
+	const bool _LoadImage( const std::string & image_filename, const uint min_word_length, const uint max_word_length );
+	const bool _Normalize( const CLanguageConfig & language_config, const CAlphabet & alphabet, TWordType & word ) const;
+	const bool _Translate( const TWordType & word, const uint language, CAlphabet::TLetterIdsList & ids ) const;
+	const bool _LoadDictionaries( const TLanguageConfigsList & language_configs, const uint min_word_length, const uint max_word_length );
+
+	// We try to extend the current path with a cell. The word found there is added to the list if asked, but the cell is only 
+	// pushed on the path if some words may still be found below.
+	template<typename Tree, typename Cells, uint Dim> void _Enter( const Tree & tree, 
+								       const TTilesGrid & tiles, 
+								       const uint cell, 
+								       const bool report, 
+								       CTraversal<Tree, Cells, Dim> & traversal, 
+								       TFoundWordsList & words ) const
+	{
+		CAlphabet::TLetterIdsListCIt it_letter;
+		const CAlphabet::TTileId tile(tiles[cell]);
+		const CAlphabet::TLetterIdsList & letters(m_Alphabet.Tile(tile));
+		const uint depth(traversal.path.size());
+		const CStep<Tree> *parent(depth > 0 ? &traversal.path.back() : NULL);
+		CStep<Tree> step;
+
+
+		step.cell        = cell;
+		step.next        = traversal.cells.First(cell);
+		step.word_id     = (parent ? parent->word_id : 0);
+		step.word_length = (parent ? parent->word_length : 0) + letters.size();
+		step.curvature   = (parent ? parent->curvature : 0.0f);
+
+		// We continue only if the current node has a correct children in the grid and if the word, whose length counts all 
+		// the letters of its tiles, is not too long. The word itself is not built: we only follow its identifier.
+		if( step.word_length > m_MaxWordLength || (step.node = tree.ChildTile((parent ? parent->node : tree.Root()), tile, letters, step.word_id)) == Tree::NIL )
+			return;
+
+		// The curvature of the previous cell is known as soon as the next one is
+		if( depth >= 2 )
+			step.curvature += CCoords::Curvature<Dim>(traversal.Components(traversal.path[depth-2].cell), traversal.Components(parent->cell), traversal.Components(cell), traversal.dim);
+
+		// If the current node is terminal for one of the asked languages, we have found a word. Then we add it to the current 
+		// list if it has a correct length, with the mean curvature of its path (a path of less than three cells is straight).
+		if( report && (tree.Languages(step.node) & m_Languages) && step.word_length >= m_MinWordLength )
+		{
+			CFoundWord word = { step.word_id, step.word_length, (depth >= 2 ? step.curvature / (depth + 1) : 0.0f) };
+
+			words.push_back(word);
+		}
+
+		// We go further only if a word below may still have a correct length, knowing that each free cell adds at most 
+		// m_MaxTileLength letters
+		const uint max_letters((tiles.size() - (depth + 1)) * m_MaxTileLength);
+		const uint max_length(Min(tree.MaxLength(step.node), max_letters)), min_length(tree.MinLength(step.node));
+
+		if( max_length == 0 || step.word_length + max_length < m_MinWordLength || min_length > max_letters || step.word_length + min_length > m_MaxWordLength )
+			return;
+
+		// The letters of the cell are not available anymore below. We also go further only if the letters needed by all the words 
+		// below are still on free cells.
+		for( it_letter=letters.begin(); it_letter!=letters.end(); it_letter++ )
+			if( --traversal.remaining[*it_letter] == 0 )
+				traversal.available &= ~(1u << *it_letter);
+
+		if( (tree.Letters(step.node) & ~traversal.available) == 0 )
+		{
+			traversal.cells.Mark(cell);
+			traversal.path.push_back(step);
+		}
+		else
+			_Restore(tiles, cell, traversal);
+	}
+
+	// We leave the last cell of the path, giving back its letters
+	template<typename Tree, typename Cells, uint Dim> void _Leave( const TTilesGrid & tiles, CTraversal<Tree, Cells, Dim> & traversal ) const
+	{
+		const uint cell(traversal.path.back().cell);
+
+
+		_Restore(tiles, cell, traversal);
+		traversal.cells.Unmark(cell);
+		traversal.path.pop_back();
+	}
+
+	// We give back the letters of a cell
+	template<typename Tree, typename Cells, uint Dim> void _Restore( const TTilesGrid & tiles, const uint cell, CTraversal<Tree, Cells, Dim> & traversal ) const
+	{
+		const CAlphabet::TLetterIdsList & letters(m_Alphabet.Tile(tiles[cell]));
+
+
+		for( CAlphabet::TLetterIdsListCIt it_letter=letters.begin(); it_letter!=letters.end(); it_letter++ )
+			if( traversal.remaining[*it_letter]++ == 0 )
+				traversal.available |= (1u << *it_letter);
+	}
+
+	// We add the paths of the grid starting with the given one as units of work, up to the depth of the units
+	void _Split( const CGrid::CAdjacency & adjacency, TCellsList & path, CWorkUnits & units ) const
+	{
+		const uint cell(path.back());
+
+
+		units.cells.insert(units.cells.end(), path.begin(), path.end());
+		units.offsets.push_back(units.cells.size());
+
+		if( path.size() < units.depth )
+		{
+			for( uint k=adjacency.offsets[cell]; k<adjacency.offsets[cell+1]; k++ )
+			{
+				if( std::find(path.begin(), path.end(), adjacency.neighbors[k]) == path.end() )
+				{
+					path.push_back(adjacency.neighbors[k]);
+					_Split(adjacency, path, units);
+					path.pop_back();
+				}
+			}
+		}
+	}
+
+	// We browse a unit of work. Its first cells are followed without giving words, since shorter units give them. If the 
+	// unit is as long as the deepest ones, the paths starting with it are then browsed in depth-first order, with an 
+	// explicit stack instead of recursion.
+	template<typename Tree, typename Cells, uint Dim> void _Solve( const Tree & tree, 
+								       const TTilesGrid & tiles, 
+								       const CWorkUnits & units, 
+								       const uint unit, 
+								       CTraversal<Tree, Cells, Dim> & traversal, 
+								       TFoundWordsList & words ) const
+	{
+		const uint begin(units.offsets[unit]), end(units.offsets[unit+1]), length(end - begin);
+		uint neighbor;
+
+
+		for( uint k=begin; k<end && traversal.path.size()==k-begin; k++ )
+			_Enter(tree, tiles, units.cells[k], k+1==end, traversal, words);
+
+		if( traversal.path.size() == length && length == units.depth )
+		{
+			while( traversal.path.size() >= length )
 			{
-				paths.push_back(new_path);
-				words.insert(new_word);
+				CStep<Tree> & step(traversal.path.back());
+
+
+				// We go to the next free neighbor of the last cell of the path, if any, or we leave it
+				if( traversal.cells.Next(step.cell, step.next, neighbor) )
+					_Enter(tree, tiles, neighbor, true, traversal, words);
+				else
+					_Leave(tiles, traversal);
 			}
+		}
 
-			// We get the neighbors of p
-			neighbors = (m_PeriodicBorders ? grid.PeriodicNeighbors(p, 1) : grid.Neighbors(p, 1));
+		while( !traversal.path.empty() )
+			_Leave(tiles, traversal);
+	}
+
+	template<typename Tree> void _SolveGrid( const Tree & tree, 
+						 const CGrid & grid, 
+						 const TTilesGrid & tiles, 
+						 const CAlphabet::TLetterCountsList & counts, 
+						 TFoundWordsTable & words ) const
+	{
+		const CGrid::CAdjacency & adjacency(grid.Adjacency(m_PeriodicBorders));
+		TComponentsList components;
+		TCellsList path;
+		CWorkUnits units;
+		uint letters(0);
 
-			for( it_coords=neighbors.begin(); it_coords!=neighbors.end(); it_coords++ )
+
+		// We assign the number of threads as the number of processors
+		omp_set_num_threads(omp_get_num_procs());
+
+		// The coordinates of the cells are only needed for the curvatures
+		components.reserve(grid.TotalSize() * grid.Dim());
+
+		for( uint cell=0; cell<grid.TotalSize(); cell++ )
+		{
+			const CCoords c(grid.Coords(cell));
+			components.insert(components.end(), c.Begin(), c.End());
+		}
+
+		// We get the mask of the letters of the grid
+		for( uint k=0; k<counts.size(); k++ )
+			if( counts[k] > 0 )
+				letters |= (1u << k);
+
+		//------------------------------------------------------------------------------------------------------------
+		// The starting cells alone are too few to keep all the threads busy, and some of them give much more paths than 
+		// others. The search is thus split into the paths of two cells, or three cells when there are still too few of 
+		// them for the number of threads. Each unit gives its own list of words, so that the words are the same, and in 
+		// the same order, as if a single thread had browsed the grid.
+		//------------------------------------------------------------------------------------------------------------
+		for( units.depth=2; ; units.depth++ )
+		{
+			units.offsets.assign(1, 0);
+			units.cells.clear();
+
+			for( uint cell=0; cell<grid.TotalSize(); cell++ )
 			{
-				// If the neighbor is not marked ...
-				if( std::find(visited_nodes.begin(), visited_nodes.end(), *it_coords) == visited_nodes.end() )
+				path.assign(1, cell);
+				_Split(adjacency, path, units);
+			}
+
+			if( units.depth == MAX_SPLIT_DEPTH || units.offsets.size() - 1 >= UNITS_PER_THREAD * uint(omp_get_max_threads()) )
+				break;
+		}
+
+		words.assign(units.offsets.size() - 1, TFoundWordsList());
+
+		switch( grid.Dim() )
+		{
+			case 2  : _SolveUnits<Tree, 2>(tree, adjacency, components, grid.Dim(), tiles, counts, letters, units, words); break;
+			case 3  : _SolveUnits<Tree, 3>(tree, adjacency, components, grid.Dim(), tiles, counts, letters, units, words); break;
+			case 4  : _SolveUnits<Tree, 4>(tree, adjacency, components, grid.Dim(), tiles, counts, letters, units, words); break;
+			default : _SolveUnits<Tree, 0>(tree, adjacency, components, grid.Dim(), tiles, counts, letters, units, words); break;
+		}
+	}
+
+	template<typename Tree, uint Dim> void _SolveUnits( const Tree & tree, 
+							    const CGrid::CAdjacency & adjacency, 
+							    const TComponentsList & components, 
+							    const uint dim, 
+							    const TTilesGrid & tiles, 
+							    const CAlphabet::TLetterCountsList & counts, 
+							    const uint letters, 
+							    const CWorkUnits & units, 
+							    TFoundWordsTable & words ) const
+	{
+		// The cells of small grids fit in masks of bits, which are much cheaper to browse
+		if( adjacency.masks.empty() )
+			_SolveUnits<Tree, CCellsList, Dim>(tree, adjacency, components, dim, tiles, counts, letters, units, words);
+		else
+			_SolveUnits<Tree, CCellsMask, Dim>(tree, adjacency, components, dim, tiles, counts, letters, units, words);
+	}
+
+	template<typename Tree, typename Cells, uint Dim> void _SolveUnits( const Tree & tree, 
+									    const CGrid::CAdjacency & adjacency, 
+									    const TComponentsList & components, 
+									    const uint dim, 
+									    const TTilesGrid & tiles, 
+									    const CAlphabet::TLetterCountsList & counts, 
+									    const uint letters, 
+									    const CWorkUnits & units, 
+									    TFoundWordsTable & words ) const
+	{
+		#pragma omp parallel
+		{
+			CTraversal<Tree, Cells, Dim> traversal;
+
+			// The buffers of the traversal are allocated once per thread: a path never holds more cells than the grid. 
+			// The counts of the letters are given back as the paths are left, so they are shared by all the units.
+			traversal.path.reserve(tiles.size());
+			traversal.cells.Init(adjacency, tiles.size());
+			traversal.remaining  = counts;
+			traversal.available  = letters;
+			traversal.dim        = dim;
+			traversal.components = &components[0];
+
+			// The units are scheduled dynamically, so that a thread which is done takes the next unit
+			#pragma omp for schedule(dynamic)
+			for( int unit=0; unit<int(words.size()); unit++ )
+				_Solve(tree, tiles, units, unit, traversal, words[unit]);
+		}
+	}
+
+	// We keep each word once, thanks to a bitset indexed by the identifiers of the words whose blocks are set atomically, 
+	// and we compute the score. Each thread keeps the words it has been the first to find.
+	void _MergeWords( const TFoundWordsTable & words )
+	{
+		std::vector<TWordIdsList> word_ids(omp_get_max_threads());
+		std::vector<int> scores(omp_get_max_threads(), 0);
+
+
+		#pragma omp parallel
+		{
+			TWordIdsList & local_word_ids(word_ids[omp_get_thread_num()]);
+			int & local_score(scores[omp_get_thread_num()]);
+
+			#pragma omp for schedule(dynamic)
+			for( int k=0; k<int(words.size()); k++ )
+			{
+				for( TFoundWordsListCIt it_words=words[k].begin(); it_words!=words[k].end(); it_words++ )
 				{
-					// We add the neighbor
-					visited_nodes.push_back(p);
+					uint & block(m_FoundWords[it_words->id / 32]), previous;
+					const uint mask(1u << (it_words->id % 32));
+
+					#pragma omp atomic capture
+					{ previous = block; block |= mask; }
 
-					// We launch again the process from this neighbor
-					_Solve(grid, *it_coords, children, new_word, new_path, visited_nodes, words, paths);
+					if( !(previous & mask) )
+					{
+						local_word_ids.push_back(it_words->id);
+						local_score += it_words->length;
+					}
 				}
 			}
 		}
+
+		m_WordIds.clear();
+
+		for( uint k=0; k<word_ids.size(); k++ )
+		{
+			m_WordIds.insert(m_WordIds.end(), word_ids[k].begin(), word_ids[k].end());
+			m_Score += scores[k];
+		}
+
+		// Only the blocks which have been set are cleared for the next resolution
+		for( TWordIdsListCIt it=m_WordIds.begin(); it!=m_WordIds.end(); it++ )
+			m_FoundWords[*it / 32] = 0;
+
+		std::sort(m_WordIds.begin(), m_WordIds.end());
 	}
 
      public :
 	CLexicographicTree();
 	virtual ~CLexicographicTree();
-	const bool Load( const std::string & dict_filename, const uint min_word_length, const uint max_word_length );
+	const bool Load( const CLanguageConfig & language_config, const uint min_word_length, const uint max_word_length );
+	const bool Load( const TLanguageConfigsList & language_configs, const uint min_word_length, const uint max_word_length );
 	const uint GetNumberOfWords() const;
 	void SaveWords( const std::string & dict_filename ) const;
+	const bool SaveImage( const std::string & image_filename ) const;
+	const bool AddWord( const TWordType & word, const CFlatTree::TLanguagesMask languages = CFlatTree::ALL_LANGUAGES );
+	const bool RemoveWord( const TWordType & word, const CFlatTree::TLanguagesMask languages = CFlatTree::ALL_LANGUAGES );
+	TWordType Word( const uint word_id ) const;
+	TWordsList Words( const TWordIdsList & word_ids ) const;
 	void PeriodicBorders( const bool periodic_borders );
 	const bool & PeriodicBorders() const;
-
-	TWordsList Solve( const CGrid & grid )
+	void Minimize( const bool minimize );
+	const bool & Minimize() const;
+	void GridPruning( const bool grid_pruning );
+	const bool & GridPruning() const;
+	void Succinct( const bool succinct );
+	const bool & Succinct() const;
+	const size_t Bytes() const;
+	CTreeStats Stats() const;
+	void Languages( const CFlatTree::TLanguagesMask languages );
+	const CFlatTree::TLanguagesMask & Languages() const;
+	const uint & NbOfLanguages() const;
+
+	const TWordIdsList & Solve( const CGrid & grid )
 	{
-		TWordsList final_words;
-		TPathsList final_paths;
-		TWordsListCIt it_words;
-		TPathsListCIt it_paths;
-		TCoordsList visited_nodes;
+		TFoundWordsTable final_words;
+		TFoundWordsListCIt it_words;
+		uint nb_words(0);
+		TTilesGrid tiles(grid.TotalSize());
+		std::vector<int> grid_tiles(grid.Tiles().size(), -1);
+		CAlphabet::TLetterCountsList counts(CAlphabet::NONE+1, 0);
+		CFlatTree *tree(&m_FlatTree);
 
 
 		// We reinit the score and the mean curvature
 		m_Score         = 0;
 		m_MeanCurvature = 0.0f;
 
-		// We assign the number of threads as the number of processors
-		omp_set_num_threads(omp_get_num_procs());
+		// We translate the grid once into tiles, whose letters are counted. A cell which is not a letter of the config is 
+		// added to the tiles. Each tile of the grid is only looked up once, the cells being read as identifiers.
+		m_MaxTileLength = 0;
 
-		// We add the first node position
-		visited_nodes.push_back(CCoords(grid.Dim(), 0));
-
-		// We browse the grid
-		//#pragma omp parallel private(it_words,it_paths)
-		for( CCoordsIterator it_coords(grid.Begin()); it_coords!=grid.End(); it_coords++ )
+		for( uint k=0; k<tiles.size(); k++ )
 		{
-			// We launch the process for each point and gather final words and paths
-			TWordsList tmp_words;
-			TPathsList tmp_paths;
+			int & tile(grid_tiles[grid.Tile(k)]);
 
-			_Solve(grid, *it_coords, m_Root, "", CPath(grid.Dim()), visited_nodes, tmp_words, tmp_paths);
+			if( tile < 0 )
+				tile = m_Alphabet.AddTile(grid(k));
 
-			for( it_words=tmp_words.begin(); it_words!=tmp_words.end(); it_words++ )
-			{
-				//#pragma omp critical
-				{
-					final_words.insert(*it_words);
-				}
-			}
+			tiles[k] = CAlphabet::TTileId(tile);
+			const CAlphabet::TLetterIdsList & letters(m_Alphabet.Tile(tiles[k]));
 
-			for( it_paths=tmp_paths.begin(); it_paths!=tmp_paths.end(); it_paths++ )
+			for( CAlphabet::TLetterIdsListCIt it_letter=letters.begin(); it_letter!=letters.end(); it_letter++ )
+				counts[*it_letter]++;
+
+			m_MaxTileLength = Max(m_MaxTileLength, uint(letters.size()));
+		}
+
+		// The succinct tree is browsed as is: it cannot be pruned
+		if( m_SuccinctTree.NbOfNodes() > 0 )
+			_SolveGrid(m_SuccinctTree, grid, tiles, counts, final_words);
+		else
+		{
+			// Identifiers of words must be computed again after words have been added or removed
+			if( !m_FlatTree.IsRanked() )
+				m_FlatTree.Rank();
+
+			// We browse a copy of the tree reduced to the words which can be spelled with the letters of the grid. 
+			// Since heuristics only swap letters, this copy is only built again when the letters change.
+			if( m_GridPruning )
 			{
-				//#pragma omp critical
+				if( counts != m_ViewCounts )
 				{
-					final_paths.push_back(*it_paths);
+					m_View.Prune(m_FlatTree, counts);
+					m_ViewCounts = counts;
 				}
+
+				tree = &m_View;
 			}
+
+			// So must the transitions of the tiles, which also cover the tiles added above. Only the browsed tree needs them.
+			tree->Compile(m_Alphabet.Tiles());
+
+			_SolveGrid(*tree, grid, tiles, counts, final_words);
 		}
 
-		// We compute the score
-		for( it_words=final_words.begin(); it_words!=final_words.end(); it_words++ )
-			m_Score += (*it_words).size();
+		m_FoundWords.resize(((m_SuccinctTree.NbOfNodes() > 0 ? m_SuccinctTree.NbOfWords() : m_FlatTree.NbOfWords()) + 31) / 32, 0);
+		_MergeWords(final_words);
+
+		// We compute the mean curvature, browsing the words in the order in which a single thread would have found them
+		for( uint k=0; k<final_words.size(); k++ )
+		{
+			for( it_words=final_words[k].begin(); it_words!=final_words[k].end(); it_words++ )
+				m_MeanCurvature += it_words->curvature;
 
-		// We compute the mean curvature
-		for( it_paths=final_paths.begin(); it_paths!=final_paths.end(); it_paths++ )
-			m_MeanCurvature += (*it_paths).MeanCurvature();
+			nb_words += final_words[k].size();
+		}
 
-		m_MeanCurvature /= final_paths.size();
+		m_MeanCurvature /= nb_words;
 
-		return final_words;
+		return m_WordIds;
 	}
 
 	const int & Score() const
@@ -0,0 +1,53 @@
+/*
+    Smoggle - A multidimensional and multi-language boggle solver
+    Copyright (C) 2009 - Nicolas Lermé <nicolas.lerme@free.fr>
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef __MAPPED_FILE_H__
+#define __MAPPED_FILE_H__
+
+#include <string>
+#include <cstddef>
+#ifdef _WIN32
+#	include <windows.h>
+#endif
+
+
+// Read-only memory mapping of a whole file. Pages are loaded on demand and shared between processes.
+class CMappedFile
+{
+     private :
+	const char *m_Data;
+	size_t m_Size;
+	#ifdef _WIN32
+		HANDLE m_File, m_Mapping;
+	#endif
+
+	CMappedFile( const CMappedFile & other );
+	CMappedFile & operator = ( const CMappedFile & other );
+
+     public :
+	CMappedFile();
+	~CMappedFile();
+	bool Open( const std::string & filename );
+	void Close();
+	const bool IsOpen() const;
+	const char* Data() const;
+	const size_t Size() const;
+};
+
+#endif //__MAPPED_FILE_H__
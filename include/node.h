@@ -21,6 +21,8 @@
 #define __NODE_H__
 
 #include <vector>
+#include <algorithm>
+#include <functional>
 #include "types.h"
 
 
@@ -44,17 +46,8 @@ template<typename Type> class CNode
 							      m_IsTerminal(is_terminal), 
 							      m_Children(children){}
 
-	~CNode()
-	{
-		TNodesListIt It(Begin());
-
-		while( It < End() )
-		{
-			delete *It;
-			*It = NULL;
-			It  = m_Children.erase(It);
-		}
-	}
+	// Nodes do not own their children: they are released by the tree (or the pool) holding them
+	~CNode(){}
 
 	const Type & Value() const
 	{
@@ -135,6 +128,22 @@ template<typename Type> class CNode
 	}
 };
 
+// Strict ordering on nodes, comparing their value, their state and the addresses of their children. Two nodes
+// are equivalent if they hold the same value and share exactly the same children.
+template<typename Type> struct CNodeLess
+{
+	bool operator () ( const CNode<Type> *a, const CNode<Type> *b ) const
+	{
+		if( a->Value() != b->Value() )
+			return (a->Value() < b->Value());
+
+		if( a->IsTerminal() != b->IsTerminal() )
+			return (a->IsTerminal() < b->IsTerminal());
+
+		return std::lexicographical_compare(a->Begin(), a->End(), b->Begin(), b->End(), std::less<CNode<Type>*>());
+	}
+};
+
 //------------- Some aliases -------------
 typedef CNode<int>         TNodeInt;
 typedef CNode<uint>        TNodeUInt;
@@ -0,0 +1,139 @@
+/*
+    Smoggle - A multidimensional and multi-language boggle solver
+    Copyright (C) 2009 - Nicolas Lermé <nicolas.lerme@free.fr>
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef __POOL_H__
+#define __POOL_H__
+
+#include <vector>
+#include <new>
+#include "types.h"
+
+
+//------------------------------------------------------------------------------------------------------------
+// Arena of objects allocated by blocks. Objects are created by bumping an index in the last block, and those
+// given back with Delete are recycled by the next calls to New. All of them are only destroyed by Clear (or
+// with the pool), in a single linear pass followed by one release per block: objects must then not free the
+// other objects of the pool by themselves.
+//------------------------------------------------------------------------------------------------------------
+template<typename Type> class CPool
+{
+     public :
+	struct CBlock
+	{
+		Type *objects;
+		uint size;
+	};
+
+	//------ Blocks ------
+	typedef std::vector<CBlock>                  TBlocksList;
+	typedef typename TBlocksList::const_iterator TBlocksListCIt;
+	typedef typename TBlocksList::iterator       TBlocksListIt;
+	//------ Objects ------
+	typedef std::vector<Type*>                    TObjectsList;
+	typedef typename TObjectsList::const_iterator TObjectsListCIt;
+	typedef typename TObjectsList::iterator       TObjectsListIt;
+
+	static const uint BLOCK_SIZE = 4096;
+
+     protected :
+	TBlocksList m_Blocks;
+	TObjectsList m_FreeObjects;
+	uint m_NbObjects;
+
+	// A pool owns its objects, so it cannot be copied
+	CPool( const CPool & pool );
+	CPool & operator = ( const CPool & pool );
+
+     public :
+	CPool() : m_NbObjects(0){}
+
+	~CPool()
+	{
+		Clear();
+	}
+
+	Type* New( const Type & value = Type() )
+	{
+		Type *object(NULL);
+
+
+		if( !m_FreeObjects.empty() )
+		{
+			object  = m_FreeObjects.back();
+			*object = value;
+			m_FreeObjects.pop_back();
+		}
+		else
+		{
+			if( m_Blocks.empty() || m_Blocks.back().size == BLOCK_SIZE )
+			{
+				CBlock block = { static_cast<Type*>(::operator new(BLOCK_SIZE * sizeof(Type))), 0 };
+				m_Blocks.push_back(block);
+			}
+
+			object = new (m_Blocks.back().objects + m_Blocks.back().size) Type(value);
+			m_Blocks.back().size++;
+		}
+
+		m_NbObjects++;
+
+		return object;
+	}
+
+	void Delete( Type *object )
+	{
+		// The object is kept alive, it will be assigned a new value when recycled
+		m_FreeObjects.push_back(object);
+		m_NbObjects--;
+	}
+
+	void Splice( CPool & pool )
+	{
+		// The blocks of the given pool are put first, so that the last block, the only one which may not be full, stays the current one
+		m_Blocks.insert(m_Blocks.begin(), pool.m_Blocks.begin(), pool.m_Blocks.end());
+		m_FreeObjects.insert(m_FreeObjects.end(), pool.m_FreeObjects.begin(), pool.m_FreeObjects.end());
+		m_NbObjects += pool.m_NbObjects;
+
+		pool.m_Blocks.clear();
+		pool.m_FreeObjects.clear();
+		pool.m_NbObjects = 0;
+	}
+
+	void Clear()
+	{
+		for( TBlocksListIt it=m_Blocks.begin(); it!=m_Blocks.end(); it++ )
+		{
+			for( uint k=0; k<it->size; k++ )
+				it->objects[k].~Type();
+
+			::operator delete(it->objects);
+		}
+
+		m_Blocks.clear();
+		TObjectsList().swap(m_FreeObjects);
+		m_NbObjects = 0;
+	}
+
+	const uint & Size() const
+	{
+		return m_NbObjects;
+	}
+};
+
+#endif //__POOL_H__
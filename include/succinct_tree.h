@@ -0,0 +1,168 @@
+/*
+    Smoggle - A multidimensional and multi-language boggle solver
+    Copyright (C) 2009 - Nicolas Lermé <nicolas.lerme@free.fr>
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef __SUCCINCT_TREE_H__
+#define __SUCCINCT_TREE_H__
+
+#include <vector>
+#include <cassert>
+#include "types.h"
+#include "alphabet.h"
+#include "bit_vector.h"
+#include "flat_tree.h"
+
+
+//------------------------------------------------------------------------------------------------------------
+// Read-only version of a lexicographic tree using a few bits per node (LOUDS encoding). Nodes are numbered in
+// breadth-first order, the root being 0, and the tree is described by the degrees of the nodes in this order:
+// d ones followed by a zero for a node having d children. The children of the node i are then the nodes
+// following the (i-1)-th zero, found with select queries. Values are stored in a separate array (one byte per
+// node), and terminal nodes in a bit vector.
+//
+// Words are identified by the rank of their terminal node among all the terminal nodes. A tree built from a
+// DAWG is expanded into a trie, since the encoding cannot share nodes.
+//------------------------------------------------------------------------------------------------------------
+class CSuccinctTree
+{
+     public :
+	typedef uint TIndex;
+	typedef CAlphabet::TLetterId TLetterId;
+	typedef CFlatTree::TLanguagesMask TLanguagesMask;
+	//------ Values ------
+	typedef std::vector<TLetterId>         TValuesList;
+	typedef TValuesList::const_iterator    TValuesListCIt;
+	//---- Languages -----
+	typedef std::vector<TLanguagesMask>    TLanguagesList;
+	typedef TLanguagesList::const_iterator TLanguagesListCIt;
+
+	static const TIndex NIL = TIndex(-1);
+
+     protected :
+	CBitVector m_Degrees, m_Terminals;
+	TValuesList m_Values;
+	TLanguagesList m_Languages;
+
+     public :
+	CSuccinctTree();
+	~CSuccinctTree();
+	void Build( const CFlatTree & tree, const uint nb_languages = 1 );
+	bool Word( const uint word_id, CAlphabet::TLetterIdsList & word ) const;
+	void Clear();
+	const uint NbOfNodes() const;
+	const uint & NbOfWords() const;
+	const size_t Bytes() const;
+
+	TIndex Root() const
+	{
+		return 0;
+	}
+
+	TLetterId Value( const TIndex node ) const
+	{
+		assert(node < m_Values.size());
+		return m_Values[node];
+	}
+
+	bool IsTerminal( const TIndex node ) const
+	{
+		return m_Terminals[node];
+	}
+
+	TLanguagesMask Languages( const TIndex node ) const
+	{
+		if( !m_Terminals[node] )
+			return 0;
+
+		// With a single language, masks are not stored
+		return (m_Languages.empty() ? 1 : m_Languages[m_Terminals.Rank1(node)]);
+	}
+
+	// Lengths and letters of the words under a node are not stored, which would double the size of the tree: they 
+	// bound nothing
+	uint Letters( const TIndex node ) const
+	{
+		return 0;
+	}
+
+	uint MinLength( const TIndex node ) const
+	{
+		return 0;
+	}
+
+	uint MaxLength( const TIndex node ) const
+	{
+		return CFlatTree::NO_MAX_LENGTH;
+	}
+
+	TIndex FirstChild( const TIndex node ) const
+	{
+		// The first child is the node of the first one of the group of ones of the node
+		return ((node == 0 ? 0 : m_Degrees.Select0(node-1) + 1) - node + 1);
+	}
+
+	TIndex NbOfChildren( const TIndex node ) const
+	{
+		return (m_Degrees.Select0(node) - (node == 0 ? 0 : m_Degrees.Select0(node-1) + 1));
+	}
+
+	TIndex Parent( const TIndex node ) const
+	{
+		assert(node > 0);
+		return m_Degrees.Rank0(m_Degrees.Select1(node-1));
+	}
+
+	TIndex Child( const TIndex node, const TLetterId value ) const
+	{
+		const uint start(node == 0 ? 0 : m_Degrees.Select0(node-1) + 1), end(m_Degrees.Select0(node));
+		const TIndex first_child(start - node + 1);
+
+
+		// Children are sorted by value
+		for( TIndex it=first_child; it<first_child+(end-start) && m_Values[it] <= value; it++ )
+			if( m_Values[it] == value )
+				return it;
+
+		return NIL;
+	}
+
+	TIndex ChildWord( TIndex node, const CAlphabet::TLetterIdsList & word ) const
+	{
+		for( uint k=0; k<word.size() && node != NIL; k++ )
+			node = Child(node, word[k]);
+
+		return node;
+	}
+
+	// Same interface as the flat tree, but the identifier does not depend on the given one: it is the rank of the node
+	TIndex ChildWord( TIndex node, const CAlphabet::TLetterIdsList & word, uint & word_id ) const
+	{
+		if( (node = ChildWord(node, word)) != NIL )
+			word_id = m_Terminals.Rank1(node);
+
+		return node;
+	}
+
+	// Tiles are not compiled, which would take much more memory than the tree itself
+	TIndex ChildTile( const TIndex node, const CAlphabet::TTileId tile, const CAlphabet::TLetterIdsList & letters, uint & word_id ) const
+	{
+		return ChildWord(node, letters, word_id);
+	}
+};
+
+#endif //__SUCCINCT_TREE_H__
@@ -38,6 +38,12 @@ class CColon : public std::unary_function<char, bool>
 	bool operator () ( char c ) const;
 };
 
+class CComma : public std::unary_function<char, bool>
+{
+     public :
+	bool operator () ( char c ) const;
+};
+
 class CNewLine : public std::unary_function<char, bool>
 {
      public :
@@ -84,5 +90,6 @@ template<typename Predicate> class CTokenizer
 typedef CTokenizer<CSpace> CSpaceTokenizer;
 typedef CTokenizer<CNewLine> CNewLineTokenizer;
 typedef CTokenizer<CColon> CColonTokenizer;
+typedef CTokenizer<CComma> CCommaTokenizer;
 
 #endif //__TOKENIZER_H__
@@ -75,6 +75,22 @@ template<typename Type> class CTree
 		return (Result + 1);
 	}
 
+	void _Release( TNode *Node )
+	{
+		if( !Node )
+			return;
+
+		TNodesListIt It(Node->Begin());
+
+		while( It < Node->End() )
+		{
+			_Release(*It);
+			It++;
+		}
+
+		delete Node;
+	}
+
 	void _Print( TNode *Node, const uint Depth ) const
 	{
 		if( !Node )
@@ -103,7 +119,7 @@ template<typename Type> class CTree
 	~CTree()
 	{
 		// Recursive destruction of the n-tree
-		delete m_Root;
+		_Release(m_Root);
 		m_Root = NULL;
 	}
 
@@ -0,0 +1,77 @@
+/*
+    Smoggle - A multidimensional and multi-language boggle solver
+    Copyright (C) 2009 - Nicolas Lermé <nicolas.lerme@free.fr>
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef __TREE_STATS_H__
+#define __TREE_STATS_H__
+
+#include <vector>
+#include <ostream>
+#include "types.h"
+
+
+//------------------------------------------------------------------------------------------------------------
+// Statistics of a loaded dictionary. The stored nodes are the ones held in memory, while the histograms are
+// filled by browsing the tree as a trie: in a DAWG, a shared node is counted once per path leading to it.
+// Partial statistics of sub-trees can be merged, so that they are gathered in parallel.
+//------------------------------------------------------------------------------------------------------------
+class CTreeStats
+{
+     public :
+	//------ Counts ------
+	typedef std::vector<ullong>        TCountsList;
+	typedef TCountsList::const_iterator TCountsListCIt;
+
+	//---- Histograms ----
+	typedef std::vector<TCountsList>       THistogramsList;
+	typedef THistogramsList::const_iterator THistogramsListCIt;
+
+     protected :
+	TCountsList m_Nodes, m_Terminals;
+	THistogramsList m_Branching;
+	uint m_NbStoredNodes;
+	size_t m_TreeBytes, m_ResidentBytes;
+
+     public :
+	CTreeStats();
+	~CTreeStats();
+	void AddNode( const uint depth, const uint nb_children, const bool is_terminal );
+	void Merge( const CTreeStats & other );
+	void Clear();
+	void NbOfStoredNodes( const uint nb_stored_nodes );
+	const uint & NbOfStoredNodes() const;
+	void TreeBytes( const size_t tree_bytes );
+	const size_t & TreeBytes() const;
+	void ResidentBytes( const size_t resident_bytes );
+	const size_t & ResidentBytes() const;
+	const ullong NbOfNodes() const;
+	const ullong NbOfTerminals() const;
+	const uint Height() const;
+	const TCountsList & Nodes() const;
+	const TCountsList & Terminals() const;
+	const THistogramsList & Branching() const;
+	void Print( std::ostream & out ) const;
+
+	friend std::ostream & operator << ( std::ostream & out, const CTreeStats & other )
+	{
+		other.Print(out);
+		return out;
+	}
+};
+
+#endif //__TREE_STATS_H__
@@ -27,6 +27,7 @@
 typedef std::string TWordType;
 typedef unsigned int uint;
 typedef unsigned long ulong;
+typedef unsigned long long ullong;
 typedef unsigned short ushort;
 typedef unsigned char uchar;
 
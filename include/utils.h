@@ -55,6 +55,43 @@ template<typename Type> Type Max( const Type a, const Type b )
 	return (a > b ? a : b);
 }
 
+// Number of bits set in a 32-bit word (the builtin is only used when the CPU has a dedicated instruction)
+inline uint PopCount( const uint x )
+{
+#if defined(__GNUC__) && defined(__POPCNT__)
+	return __builtin_popcount(x);
+#else
+	uint v(x - ((x >> 1) & 0x55555555));
+	v = (v & 0x33333333) + ((v >> 2) & 0x33333333);
+	return ((((v + (v >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24);
+#endif
+}
+
+// Number of bits set in a 64-bit word
+inline uint PopCount( const ullong x )
+{
+#if defined(__GNUC__) && defined(__POPCNT__)
+	return __builtin_popcountll(x);
+#else
+	return (PopCount(uint(x)) + PopCount(uint(x >> 32)));
+#endif
+}
+
+// Position of the lowest bit set in a non-null 64-bit word
+inline uint LowestBit( const ullong x )
+{
+#if defined(__GNUC__)
+	return __builtin_ctzll(x);
+#else
+	uint k(0);
+
+	while( !((x >> k) & 1) )
+		k++;
+
+	return k;
+#endif
+}
+
 template<typename Type> inline bool IsNumeric(){ return false; }
 template<> inline bool IsNumeric<short>(){ return true; }
 template<> inline bool IsNumeric<ushort>(){ return true; }
@@ -116,6 +153,17 @@ inline int LastCommonPosition( const std::string & str1, const std::string & str
 	return (k-1);
 }
 
+// Returns the lowercase version of a ISO-8859-1 character (the C locale only knows ASCII letters)
+inline char ToLower( const char c )
+{
+	const uchar u(c);
+
+	if( (u >= 'A' && u <= 'Z') || (u >= 0xC0 && u <= 0xDE && u != 0xD7) )
+		return char(u + 0x20);
+
+	return c;
+}
+
 // Returns true if the two strings are equal without regards to the case
 inline bool AreStringsEqual( const std::string & str1, const std::string & str2 )
 {
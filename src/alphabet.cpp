@@ -0,0 +1,136 @@
+/*
+    Smoggle - A multidimensional and multi-language boggle solver
+    Copyright (C) 2009 - Nicolas Lermé <nicolas.lerme@free.fr>
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <stdexcept>
+#include "utils.h"
+#include "alphabet.h"
+
+
+// The constants are also defined here, since they may be bound to references (as by std::fill)
+const CAlphabet::TLetterId CAlphabet::NONE;
+const uint CAlphabet::MAX_TILES;
+
+CAlphabet::CAlphabet()
+{
+	_Init("");
+}
+
+CAlphabet::CAlphabet( const std::string & letters )
+{
+	_Init(letters);
+}
+
+CAlphabet::CAlphabet( const CLanguageConfig & language_config )
+{
+	std::string letters;
+
+
+	// Letters of the config may hold several characters, so we gather their characters
+	for( CLanguageConfig::TLettersListCIt it=language_config.Letters().begin(); it!=language_config.Letters().end(); it++ )
+		letters += *it;
+
+	_Init(letters);
+
+	// Then each letter of the config is a tile
+	for( CLanguageConfig::TLettersListCIt it=language_config.Letters().begin(); it!=language_config.Letters().end(); it++ )
+		AddTile(*it);
+}
+
+CAlphabet::CAlphabet( const TLanguageConfigsList & language_configs )
+{
+	std::string letters;
+
+
+	// The alphabet of several languages is the union of their alphabets
+	for( TLanguageConfigsListCIt it_config=language_configs.begin(); it_config!=language_configs.end(); it_config++ )
+		for( CLanguageConfig::TLettersListCIt it=it_config->Letters().begin(); it!=it_config->Letters().end(); it++ )
+			letters += *it;
+
+	_Init(letters);
+
+	for( TLanguageConfigsListCIt it_config=language_configs.begin(); it_config!=language_configs.end(); it_config++ )
+		for( CLanguageConfig::TLettersListCIt it=it_config->Letters().begin(); it!=it_config->Letters().end(); it++ )
+			AddTile(*it);
+}
+
+CAlphabet::~CAlphabet(){}
+
+void CAlphabet::_Init( const std::string & letters )
+{
+	m_Letters.clear();
+	m_Tiles.clear();
+	m_TileIds.clear();
+	std::fill(m_Ids, m_Ids+256, NONE);
+
+	for( std::string::const_iterator it=letters.begin(); it!=letters.end(); it++ )
+	{
+		if( m_Ids[uchar(*it)] == NONE )
+		{
+			if( m_Letters.size() == NONE )
+				throw std::logic_error("an alphabet cannot hold more than " + ToString(uint(NONE)) + " characters");
+
+			m_Ids[uchar(*it)] = TLetterId(m_Letters.size());
+			m_Letters += *it;
+		}
+	}
+}
+
+const std::string & CAlphabet::Letters() const
+{
+	return m_Letters;
+}
+
+const uint CAlphabet::Size() const
+{
+	return m_Letters.size();
+}
+
+const bool CAlphabet::Translate( const TWordType & word, TLetterIdsList & ids ) const
+{
+	ids.resize(word.size());
+
+	for( uint k=0; k<word.size(); k++ )
+		if( (ids[k] = Id(word[k])) == NONE )
+			return false;
+
+	return true;
+}
+
+CAlphabet::TTileId CAlphabet::AddTile( const TWordType & tile )
+{
+	TTileIdsMapCIt it(m_TileIds.find(tile));
+
+
+	if( it != m_TileIds.end() )
+		return it->second;
+
+	if( m_Tiles.size() == MAX_TILES )
+		throw std::logic_error("an alphabet cannot hold more than " + ToString(uint(MAX_TILES)) + " tiles");
+
+	// Characters out of the alphabet are translated to NONE, so that a tile holding one of them has no child in a tree
+	m_Tiles.push_back(TLetterIdsList());
+	Translate(tile, m_Tiles.back());
+
+	return (m_TileIds[tile] = TTileId(m_Tiles.size()-1));
+}
+
+const CAlphabet::TTilesList & CAlphabet::Tiles() const
+{
+	return m_Tiles;
+}
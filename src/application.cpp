@@ -38,7 +38,8 @@ void CApplication::PrintResults( const uint nb_columns, const uint column_size )
 		if( (k++%nb_columns) == 0 )
 			std::cout << '\n';
 
-		std::cout << (*it).c_str() << std::string(column_size-(*it).size(), ' ').c_str();
+		// Words longer than a column are not padded
+		std::cout << (*it).c_str() << std::string(column_size > (*it).size() ? column_size-(*it).size() : 0, ' ').c_str();
 
 		m_WordsLengths[(*it).size()]++;
 	}
@@ -68,6 +69,7 @@ void CApplication::Run( int argc, char **argv )
 	smart_ptr<IGridFileIO> grid_io(NULL);
 	smart_ptr<IIBoggle> iboggle(NULL);
 	std::string solving_mode_str;
+	std::vector<std::string> languages;
 	CTimer timer;
 
 
@@ -83,13 +85,19 @@ void CApplication::Run( int argc, char **argv )
 	argstream as(argc, argv);
 	as >> parameter('i',            "input",  m_InputGridFilename,                                   "input grid filename", false)
 	   >> parameter('o',           "output", m_OutputGridFilename,                                  "output grid filename", false)
-	   >> parameter('l',         "language",           m_Language,                                              "language", false)
+	   >> parameter('l',         "language",           m_Language,                                              "language (or languages separated by commas)", false)
+	   >> parameter('D',       "dictionary", m_DictionaryFilename,   "dictionary filename (text or compiled image)", false)
+	   >> parameter('c',          "compile",      m_ImageFilename,      "compile the dictionary into an image file", false)
 	   >> parameter('d',         "grid-dim",            m_GridDim,                          "grid dimension (2 <= d <= 4)", false)
 	   >> parameter('n',        "grid-size",           m_GridSize,                                      "grid size (>= 3)", false)
 	   >> parameter('m',  "min-word-length",      m_MinWordLength,                        "minimum length of words (>= 3)", false)
 	   >> parameter('M',  "max-word-length",      m_MaxWordLength,                        "maximum length of words (>= 3)", false)
 	   >> parameter('s',     "solving-mode",        m_SolvingMode, "solving mode (none, direct or inverse:heuristic_name)", false)
 	   >>    option('p', "periodic-borders",    m_PeriodicBorders,                                      "periodic borders")
+	   >>    option('a',             "dawg",              m_Dawg,                  "minimize the dictionary into a DAWG")
+	   >>    option('g',     "grid-pruning",       m_GridPruning,    "prune the dictionary according to the grid letters")
+	   >>    option('S',         "succinct",          m_Succinct,  "store the dictionary in a succinct (LOUDS) tree")
+	   >>    option('t',            "stats",             m_Stats,      "print statistics of the loaded dictionary")
 	   >> help('h', "help", "Display this help");
 	as.defaultErrorHandling();
 
@@ -100,13 +108,17 @@ void CApplication::Run( int argc, char **argv )
 	if( m_MinWordLength < 3 )                               throw std::logic_error("minimum word length is >= 3");
 	if( m_MaxWordLength < 3 )                               throw std::logic_error("maximum word length is >= 3");
 	if( m_MinWordLength > m_MaxWordLength )                 throw std::logic_error("minimum word length must be <= maximum word length");
+	if( m_Succinct && !m_ImageFilename.empty() )            throw std::logic_error("a succinct dictionary cannot be compiled into an image");
 
 	//--- Program core ----------------------------------
 	timer.Init();
 	Banner();
 
-	// We set activate the periodic borders if asked
+	// We set activate the periodic borders and the minimization of the dictionary if asked
 	m_Tree.PeriodicBorders(m_PeriodicBorders);
+	m_Tree.Minimize(m_Dawg);
+	m_Tree.GridPruning(m_GridPruning);
+	m_Tree.Succinct(m_Succinct);
 
 	// Then, we either load a grid or randomly generate it
 	if( !(config_io = CConfigFileIOFactory::Create(CFile(CONFIG_FILENAME).Extension())) )
@@ -119,33 +131,55 @@ void CApplication::Run( int argc, char **argv )
 
 		if( !grid_io->Load(m_InputGridFilename, m_Grid, m_Language) )
 			throw std::logic_error("unable to load the grid");
+	}
+
+	// We load the config of each language (the words of all of them are gathered in a single tree) and check if it is consistent
+	if( (languages = CCommaTokenizer::Tokenize(m_Language)).empty() )
+		throw std::logic_error("no language given");
 
-		if( !config_io->Load(CONFIG_FILENAME, m_Language, m_LanguageConfig) )
+	m_LanguageConfigs.resize(languages.size());
+
+	for( uint k=0; k<languages.size(); k++ )
+	{
+		if( !config_io->Load(CONFIG_FILENAME, languages[k], m_LanguageConfigs[k]) )
 			throw std::logic_error("unable to load the config file");
 
-		if( m_LanguageConfig.DictionaryFilename().empty() )
+		if( m_LanguageConfigs[k].DictionaryFilename().empty() )
 			throw std::logic_error("dictionary file not found");
+
+		if( !m_LanguageConfigs[k].IsConsistent() )
+			throw std::logic_error("unable to correctly parse the config file");
 	}
-	else
+
+	// Grids are generated with the letters of the first language
+	if( m_InputGridFilename.empty() )
 	{
 		m_Grid = CGrid(m_GridDim, m_GridSize);
+		m_Grid.Generate(m_LanguageConfigs.front());
+	}
 
-		if( !config_io->Load(CONFIG_FILENAME, m_Language, m_LanguageConfig) )
-			throw std::logic_error("unable to load the config file");
-
-		if( m_LanguageConfig.DictionaryFilename().empty() )
-			throw std::logic_error("dictionary file not found");
+	// A given dictionary replaces the ones of the config. Only an image may hold several languages.
+	if( !m_DictionaryFilename.empty() )
+	{
+		if( m_LanguageConfigs.size() > 1 && !AreStringsEqual(CFile(m_DictionaryFilename).Extension(), IMAGE_EXTENSION) )
+			throw std::logic_error("a dictionary file can only be given for a single language");
 
-		m_Grid.Generate(m_LanguageConfig);
+		m_LanguageConfigs.resize(1);
+		m_LanguageConfigs.front().DictionaryFilename(m_DictionaryFilename);
 	}
 
-	// We check if the language config is consistent and build the lexicographic tree
-	if( !m_LanguageConfig.IsConsistent() )
-		throw std::logic_error("unable to correctly parse the config file");
-
-	if( !m_Tree.Load(m_LanguageConfig.DictionaryFilename(), m_MinWordLength, m_MaxWordLength) )
+	// We build the lexicographic tree
+	if( !m_Tree.Load(m_LanguageConfigs, m_MinWordLength, m_MaxWordLength) )
 		throw std::logic_error("unable to build the lexicographic tree");
 
+	// We save the compiled dictionary if asked
+	if( !m_ImageFilename.empty() && !m_Tree.SaveImage(m_ImageFilename) )
+		throw std::logic_error("unable to save the dictionary image");
+
+	// We print the statistics of the dictionary if asked
+	if( m_Stats )
+		std::cout << m_Tree.Stats();
+
 	// We print the grid
 	m_Grid.Print();
 
@@ -154,7 +188,7 @@ void CApplication::Run( int argc, char **argv )
 		;
 	else if( AreStringsEqual(m_SolvingMode, "direct") )
 	{
-		m_WordsFound = m_Tree.Solve(m_Grid);
+		m_WordsFound = m_Tree.Words(m_Tree.Solve(m_Grid));
 		PrintResults();
 	}
 	else
@@ -171,7 +205,7 @@ void CApplication::Run( int argc, char **argv )
 		std::cout << "\n[ Final solution ]\n";
 		m_Grid.Print();
 
-		m_WordsFound = m_Tree.Solve(m_Grid);
+		m_WordsFound = m_Tree.Words(m_Tree.Solve(m_Grid));
 		PrintResults();
 	}
 
@@ -0,0 +1,133 @@
+/*
+    Smoggle - A multidimensional and multi-language boggle solver
+    Copyright (C) 2009 - Nicolas Lermé <nicolas.lerme@free.fr>
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include "bit_vector.h"
+
+
+CBitVector::CBitVector() : m_Size(0), m_NbOnes(0){}
+
+CBitVector::~CBitVector(){}
+
+const uint CBitVector::_Select( const bool bit, const uint k ) const
+{
+	const uint words_per_superblock(SUPERBLOCK_SIZE / WORD_SIZE);
+	uint superblock(m_Selects[bit][k / SUPERBLOCK_SIZE]), count, w;
+	ullong word;
+
+
+	assert(k < (bit ? m_NbOnes : m_Size - m_NbOnes));
+
+	// We move to the last superblock starting before the k-th bit, then to the word holding it
+	while( superblock + 1 < m_Ranks.size() && (bit ? m_Ranks[superblock+1] : (superblock+1) * SUPERBLOCK_SIZE - m_Ranks[superblock+1]) <= k )
+		superblock++;
+
+	count = (bit ? m_Ranks[superblock] : superblock * SUPERBLOCK_SIZE - m_Ranks[superblock]);
+
+	for( w=superblock*words_per_superblock; ; w++ )
+	{
+		word = (bit ? m_Words[w] : ~m_Words[w]);
+
+		if( count + PopCount(word) > k )
+			break;
+
+		count += PopCount(word);
+	}
+
+	// The bits of the word before the wanted one are cleared
+	for( ; count<k; count++ )
+		word &= word - 1;
+
+	return (w * WORD_SIZE + LowestBit(word));
+}
+
+void CBitVector::PushBack( const bool bit )
+{
+	if( m_Size % WORD_SIZE == 0 )
+		m_Words.push_back(0);
+
+	if( bit )
+	{
+		m_Words.back() |= (ullong(1) << (m_Size % WORD_SIZE));
+		m_NbOnes++;
+	}
+
+	m_Size++;
+}
+
+void CBitVector::Build()
+{
+	uint counts[2] = { 0, 0 }, bits;
+	bool bit;
+
+
+	m_Ranks.clear();
+	m_Selects[0].clear();
+	m_Selects[1].clear();
+
+	// The last superblock is complete, so that ranks can be asked up to the size
+	for( uint k=0; k<=m_Size || k%SUPERBLOCK_SIZE!=0; k+=WORD_SIZE )
+	{
+		if( k % SUPERBLOCK_SIZE == 0 )
+			m_Ranks.push_back(counts[1]);
+
+		if( k >= m_Size )
+			continue;
+
+		// We note the superblock of each bit whose number is a multiple of the superblock size
+		bits = Min(WORD_SIZE, m_Size - k);
+
+		for( uint j=0; j<bits; j++ )
+		{
+			bit = ((m_Words[k / WORD_SIZE] >> j) & 1);
+
+			if( counts[bit] % SUPERBLOCK_SIZE == 0 )
+				m_Selects[bit].push_back((k + j) / SUPERBLOCK_SIZE);
+
+			counts[bit]++;
+		}
+	}
+
+	// Words are also completed up to the last superblock
+	m_Words.resize(m_Ranks.size() * (SUPERBLOCK_SIZE / WORD_SIZE), 0);
+}
+
+void CBitVector::Clear()
+{
+	TWordsList().swap(m_Words);
+	TCountsList().swap(m_Ranks);
+	TCountsList().swap(m_Selects[0]);
+	TCountsList().swap(m_Selects[1]);
+	m_Size   = 0;
+	m_NbOnes = 0;
+}
+
+const uint & CBitVector::Size() const
+{
+	return m_Size;
+}
+
+const uint & CBitVector::NbOfOnes() const
+{
+	return m_NbOnes;
+}
+
+const size_t CBitVector::Bytes() const
+{
+	return (m_Words.size() * sizeof(ullong) + (m_Ranks.size() + m_Selects[0].size() + m_Selects[1].size()) * sizeof(uint));
+}
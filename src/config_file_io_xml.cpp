@@ -28,12 +28,19 @@ bool CConfigFileIOXML::_ParseLanguage( xmlNodePtr node, CLanguageConfig & langua
 {
 	xmlChar *language(xmlGetProp(node, BAD_CAST "value"));
 	xmlChar *dictionary(xmlGetProp(node, BAD_CAST "dictionary"));
+	xmlChar *case_folding(xmlGetProp(node, BAD_CAST "case_folding"));
+	xmlChar *stripped(xmlGetProp(node, BAD_CAST "stripped"));
 	bool res(false);
 
 
 	if( xmlStrlen(language) != 0 && xmlStrlen(dictionary) != 0 && xmlStrEqual(language, (xmlChar*)language_config.Language().c_str()) )
 	{
 		language_config.DictionaryFilename(std::string((char*)dictionary));
+
+		// Normalization of the words of the dictionary (both attributes are optional)
+		language_config.CaseFolding(case_folding != NULL && xmlStrEqual(case_folding, BAD_CAST "yes"));
+		language_config.StrippedCharacters(stripped != NULL ? std::string((char*)stripped) : "");
+
 		node = node->xmlChildrenNode;
 
 		while( node != NULL )
@@ -47,6 +54,8 @@ bool CConfigFileIOXML::_ParseLanguage( xmlNodePtr node, CLanguageConfig & langua
 
 	xmlFree(language);
 	xmlFree(dictionary);
+	xmlFree(case_folding);
+	xmlFree(stripped);
 
 	return res;
 }
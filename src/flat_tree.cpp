@@ -0,0 +1,541 @@
+/*
+    Smoggle - A multidimensional and multi-language boggle solver
+    Copyright (C) 2009 - Nicolas Lermé <nicolas.lerme@free.fr>
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <algorithm>
+#include "flat_tree.h"
+
+
+// The constants are also defined here, since they may be bound to references (as by std::vector or default arguments)
+const CFlatTree::TIndex CFlatTree::NIL;
+const uint CFlatTree::MAX_LANGUAGES;
+const CFlatTree::TLanguagesMask CFlatTree::ALL_LANGUAGES;
+const uint CFlatTree::MAX_LENGTH;
+const uint CFlatTree::NO_MAX_LENGTH;
+
+// Orders nodes by the identifier of their letter
+struct CLetterLess
+{
+	const CAlphabet & alphabet;
+	CLetterLess( const CAlphabet & _alphabet ) : alphabet(_alphabet){}
+
+	bool operator () ( const TNodeChar *a, const TNodeChar *b ) const
+	{
+		return (alphabet.Id(a->Value()) < alphabet.Id(b->Value()));
+	}
+};
+
+CFlatTree::CFlatTree() : m_Data(NULL), m_NbNodes(0), m_NbGarbageNodes(0), m_NbWords(0), m_SharedChildren(false), m_Ranked(false){}
+
+CFlatTree::~CFlatTree(){}
+
+void CFlatTree::_Build( const TNodeChar *node, const TIndex index, const CAlphabet & alphabet, const uint nb_languages, TBlocksMap *blocks )
+{
+	TIndex first_child(m_Nodes.size());
+	TNodeChar::TNodesList children;
+	TNodeChar::TNodesListCIt it;
+	TBlocksMapCIt it_block;
+	TLetterId id;
+	uint language;
+
+
+	// With several languages, the last node of a word has a child for each language accepting it, whose value is the
+	// index of the language plus one (see CLexicographicTree::Load). These children become the mask of the node.
+	if( nb_languages > 1 )
+	{
+		m_Nodes[index].languages = 0;
+
+		for( it=node->Begin(); it<node->End(); it++ )
+			if( (language = uchar((*it)->Value()) - 1u) < nb_languages )
+				m_Nodes[index].languages |= (1u << language);
+	}
+
+	// Identical lists of children (which only happen in a DAWG) are stored once
+	if( blocks != NULL && !node->IsLeaf() && (it_block = blocks->find(node->Children())) != blocks->end() )
+	{
+		m_Nodes[index].children    = m_Nodes[it_block->second].children;
+		m_Nodes[index].first_child = m_Nodes[it_block->second].first_child;
+		return;
+	}
+
+	// Children whose letter is not in the alphabet can never be reached, so they are dropped
+	for( it=node->Begin(); it<node->End(); it++ )
+		if( alphabet.Id((*it)->Value()) != CAlphabet::NONE )
+			children.push_back(*it);
+
+	std::sort(children.begin(), children.end(), CLetterLess(alphabet));
+
+	m_Nodes[index].children    = 0;
+	m_Nodes[index].first_child = first_child;
+
+	// The children are pushed together before going down, so that siblings are contiguous in memory
+	for( it=children.begin(); it<children.end(); it++ )
+	{
+		id = alphabet.Id((*it)->Value());
+		m_Nodes[index].children |= (1u << id);
+
+		CFlatNode child = { 0, 0, 0, 0, id, TLanguagesMask((*it)->IsTerminal() ? 1 : 0), 0, 0 };
+		m_Nodes.push_back(child);
+	}
+
+	if( blocks != NULL && !node->IsLeaf() )
+		blocks->insert(std::make_pair(node->Children(), index));
+
+	for( it=children.begin(); it<children.end(); it++ )
+		_Build(*it, first_child + TIndex(it - children.begin()), alphabet, nb_languages, blocks);
+}
+
+void CFlatTree::Build( const TNodeChar *root, const CAlphabet & alphabet, const uint nb_nodes, const bool share_children, const uint nb_languages )
+{
+	CFlatNode flat_root = { 0, 0, 0, 0, CAlphabet::NONE, TLanguagesMask(root->IsTerminal() ? 1 : 0), 0, 0 };
+	TBlocksMap blocks;
+
+
+	assert(nb_languages >= 1 && nb_languages <= MAX_LANGUAGES);
+
+	m_Nodes.clear();
+	m_Nodes.reserve(nb_nodes);
+	m_Nodes.push_back(flat_root);
+
+	_Build(root, Root(), alphabet, nb_languages, (share_children ? &blocks : NULL));
+
+	// The given number of nodes also counts the nodes which are not kept (the markers of the languages and the shared 
+	// blocks), so we give back the capacity left
+	TFlatNodesList(m_Nodes).swap(m_Nodes);
+
+	m_NbGarbageNodes = 0;
+	m_SharedChildren = share_children;
+	_Update();
+	Rank();
+}
+
+CFlatTree::TIndex CFlatTree::_Prune( const CFlatTree & tree, const TIndex node, CAlphabet::TLetterCountsList & counts, uint & children )
+{
+	CFlatNode block[CAlphabet::NONE];
+	TIndex it(tree.FirstChild(node)), end(it + tree.NbOfChildren(node)), first_child;
+	uint nb_children(0), grand_children;
+	TLetterId id;
+
+
+	// A child is kept if its letter is still available and if it leads to at least one word
+	for( ; it<end; it++ )
+	{
+		id = tree.Value(it);
+
+		if( counts[id] == 0 )
+			continue;
+
+		counts[id]--;
+		first_child = _Prune(tree, it, counts, grand_children);
+		counts[id]++;
+
+		if( tree.IsTerminal(it) || grand_children != 0 )
+		{
+			block[nb_children]             = tree.m_Data[it];
+			block[nb_children].children    = grand_children;
+			block[nb_children].first_child = first_child;
+			nb_children++;
+		}
+	}
+
+	// Blocks are pushed after the blocks of their descendants, once we know which children are kept
+	first_child = m_Nodes.size();
+	children    = 0;
+
+	for( uint k=0; k<nb_children; k++ )
+	{
+		children |= (1u << block[k].value);
+		m_Nodes.push_back(block[k]);
+	}
+
+	return first_child;
+}
+
+void CFlatTree::Prune( const CFlatTree & tree, const CAlphabet::TLetterCountsList & counts )
+{
+	CAlphabet::TLetterCountsList remaining(counts);
+	uint children;
+
+
+	assert(&tree != this && tree.NbOfNodes() > 0 && counts.size() > CAlphabet::NONE);
+
+	m_Nodes.clear();
+	m_Nodes.push_back(tree.m_Data[tree.Root()]);
+	m_Nodes[0].first_child = _Prune(tree, tree.Root(), remaining, children);
+	m_Nodes[0].children    = children;
+
+	// Nodes keep their rank in the original tree, and so do words their identifiers
+	m_NbGarbageNodes = 0;
+	m_NbWords        = tree.m_NbWords;
+	m_SharedChildren = false;
+	m_Ranked         = tree.m_Ranked;
+	m_Transitions.clear();
+	_Update();
+
+	// But the lengths and the letters of the remaining words are tighter
+	std::vector<bool> done(m_NbNodes, false);
+	_Bound(Root(), done);
+}
+
+void CFlatTree::Attach( const void *data, const uint nb_nodes, const uint nb_words )
+{
+	assert(data != NULL && nb_nodes > 0);
+
+	// The nodes are not copied, so the given memory must outlive the tree
+	TFlatNodesList().swap(m_Nodes);
+	m_Data           = static_cast<const CFlatNode*>(data);
+	m_NbNodes        = nb_nodes;
+	m_NbGarbageNodes = 0;
+	m_NbWords        = nb_words;
+	m_SharedChildren = false;
+	m_Ranked         = true;
+	m_Transitions.clear();
+}
+
+bool CFlatTree::Save( std::ostream & out ) const
+{
+	out.write(reinterpret_cast<const char*>(m_Data), std::streamsize(m_NbNodes) * sizeof(CFlatNode));
+	return out.good();
+}
+
+void CFlatTree::_Copy( const CFlatTree & tree, const TIndex node, const TIndex index )
+{
+	TIndex it(tree.FirstChild(node)), end(it + tree.NbOfChildren(node)), first_child(m_Nodes.size());
+
+
+	m_Nodes[index].first_child = first_child;
+
+	for( ; it<end; it++ )
+		m_Nodes.push_back(tree.m_Data[it]);
+
+	for( it=tree.FirstChild(node); it<end; it++ )
+		_Copy(tree, it, first_child + (it - tree.FirstChild(node)));
+}
+
+const uint CFlatTree::_Rank( const TIndex node, TIndexesList & counts )
+{
+	TIndex it(FirstChild(node)), end(it + NbOfChildren(node));
+	uint count(0);
+
+
+	// In a DAWG, the nodes of a shared block are reached several times, so the number of words under each node is kept
+	if( counts[node] != NIL )
+		return counts[node];
+
+	for( ; it<end; it++ )
+	{
+		m_Nodes[it].rank = count;
+		count += _Rank(it, counts);
+	}
+
+	return (counts[node] = count + (m_Nodes[node].languages != 0 ? 1 : 0));
+}
+
+void CFlatTree::_Bound( const TIndex node, std::vector<bool> & done )
+{
+	TIndex it(FirstChild(node)), end(it + NbOfChildren(node));
+	uint min_length(m_Nodes[node].languages != 0 ? 0 : MAX_LENGTH), max_length(0);
+	uint letters(m_Nodes[node].languages != 0 ? 0 : uint(-1));
+
+
+	// As for the ranks, the nodes of a shared block are only computed once
+	if( done[node] )
+		return;
+
+	// A letter is needed by all the words under a node if it is needed by all the words under each child, the letter of 
+	// the child included. The word ending at a terminal node needs no letter.
+	for( ; it<end; it++ )
+	{
+		_Bound(it, done);
+		min_length = Min(min_length, m_Nodes[it].min_length + 1u);
+		max_length = Max(max_length, Min(m_Nodes[it].max_length + 1u, MAX_LENGTH));
+		letters   &= (m_Nodes[it].letters | (1u << m_Nodes[it].value));
+	}
+
+	m_Nodes[node].min_length = uchar(Min(min_length, MAX_LENGTH));
+	m_Nodes[node].max_length = uchar(max_length);
+	m_Nodes[node].letters    = letters;
+	done[node]               = true;
+}
+
+CFlatTree::TIndex CFlatTree::_AddChild( const TIndex node, const TLetterId value )
+{
+	const uint bit(1u << value), children(m_Nodes[node].children);
+	const TIndex first_child(m_Nodes[node].first_child), nb_children(PopCount(children)), rank(PopCount(children & (bit - 1)));
+	CFlatNode child = { 0, 0, 0, 0, value, 0, 0, 0 };
+
+
+	assert(!(children & bit));
+
+	// A block at the end of the array can grow in place. Otherwise, it is moved at the end with the new child.
+	if( nb_children > 0 && first_child + nb_children == m_Nodes.size() )
+		m_Nodes.insert(m_Nodes.begin() + first_child + rank, child);
+	else
+	{
+		m_Nodes[node].first_child = m_Nodes.size();
+
+		for( TIndex k=0; k<rank; k++ )
+			m_Nodes.push_back(m_Nodes[first_child+k]);
+
+		m_Nodes.push_back(child);
+
+		for( TIndex k=rank; k<nb_children; k++ )
+			m_Nodes.push_back(m_Nodes[first_child+k]);
+
+		m_NbGarbageNodes += nb_children;
+	}
+
+	m_Nodes[node].children |= bit;
+	_Update();
+
+	return (m_Nodes[node].first_child + rank);
+}
+
+void CFlatTree::_RemoveChild( const TIndex node, const TLetterId value )
+{
+	const uint bit(1u << value), children(m_Nodes[node].children);
+	const TIndex first_child(m_Nodes[node].first_child), nb_children(PopCount(children)), rank(PopCount(children & (bit - 1)));
+
+
+	assert(children & bit);
+
+	// The next siblings are shifted, so that the block stays contiguous. Its last node is then lost.
+	for( TIndex k=rank+1; k<nb_children; k++ )
+		m_Nodes[first_child+k-1] = m_Nodes[first_child+k];
+
+	if( first_child + nb_children == m_Nodes.size() )
+		m_Nodes.pop_back();
+	else
+		m_NbGarbageNodes++;
+
+	m_Nodes[node].children &= ~bit;
+	_Update();
+}
+
+void CFlatTree::_Compact()
+{
+	CFlatTree tree;
+
+
+	// The reachable nodes are copied in the same order as a fresh build
+	tree.m_Nodes.reserve(m_NbNodes - m_NbGarbageNodes);
+	tree.m_Nodes.push_back(m_Data[Root()]);
+	tree._Copy(*this, Root(), Root());
+
+	m_Nodes.swap(tree.m_Nodes);
+	m_NbGarbageNodes = 0;
+	_Update();
+}
+
+void CFlatTree::_Update()
+{
+	m_Data    = &m_Nodes[0];
+	m_NbNodes = m_Nodes.size();
+}
+
+bool CFlatTree::Insert( const CAlphabet::TLetterIdsList & word, const TLanguagesMask languages )
+{
+	TIndex node(Root()), child;
+
+
+	assert(IsEditable());
+
+	for( uint k=0; k<word.size(); k++ )
+	{
+		if( (child = Child(node, word[k])) == NIL )
+			child = _AddChild(node, word[k]);
+
+		node = child;
+	}
+
+	if( (m_Nodes[node].languages & languages) == languages )
+		return false;
+
+	m_Nodes[node].languages |= languages;
+	m_Ranked                 = false;
+	m_Transitions.clear();
+
+	if( 2 * m_NbGarbageNodes > m_NbNodes )
+		_Compact();
+
+	return true;
+}
+
+bool CFlatTree::Erase( const CAlphabet::TLetterIdsList & word, const TLanguagesMask languages )
+{
+	TIndexesList path(1, Root());
+	TIndex child;
+
+
+	assert(IsEditable());
+
+	for( uint k=0; k<word.size(); k++ )
+	{
+		if( (child = Child(path.back(), word[k])) == NIL )
+			return false;
+
+		path.push_back(child);
+	}
+
+	if( !(m_Nodes[path.back()].languages & languages) )
+		return false;
+
+	m_Nodes[path.back()].languages &= ~languages;
+	m_Ranked                        = false;
+	m_Transitions.clear();
+
+	// From the deepest one, nodes which do not lead to any word anymore are removed from their parent
+	for( uint k=word.size(); k>0 && m_Nodes[path[k]].languages == 0 && m_Nodes[path[k]].children == 0; k-- )
+		_RemoveChild(path[k-1], word[k-1]);
+
+	if( 2 * m_NbGarbageNodes > m_NbNodes )
+		_Compact();
+
+	return true;
+}
+
+const bool CFlatTree::IsEditable() const
+{
+	return (!m_Nodes.empty() && !m_SharedChildren);
+}
+
+void CFlatTree::Rank()
+{
+	TIndexesList counts(m_NbNodes, NIL);
+	std::vector<bool> done(m_NbNodes, false);
+
+
+	assert(!m_Nodes.empty());
+
+	m_NbWords = _Rank(Root(), counts);
+	_Bound(Root(), done);
+	m_Ranked  = true;
+	m_Transitions.clear();
+}
+
+const bool & CFlatTree::IsRanked() const
+{
+	return m_Ranked;
+}
+
+void CFlatTree::Compile( const CAlphabet::TTilesList & tiles )
+{
+	assert(m_Ranked);
+
+	// Tiles are only appended to the table of an alphabet, so only the new ones are compiled
+	for( uint k=m_Transitions.size(); k<tiles.size(); k++ )
+	{
+		m_Transitions.push_back(TTransitionsList());
+
+		if( tiles[k].size() < 2 )
+			continue;
+
+		m_Transitions.back().resize(m_NbNodes);
+
+		for( TIndex node=0; node<m_NbNodes; node++ )
+		{
+			CTransition & transition(m_Transitions.back()[node]);
+
+			transition.word_id = 0;
+			transition.node    = ChildWord(node, tiles[k], transition.word_id);
+		}
+	}
+}
+
+bool CFlatTree::Word( uint word_id, CAlphabet::TLetterIdsList & word ) const
+{
+	TIndex node(Root()), it, end;
+
+
+	assert(m_Ranked);
+	word.clear();
+
+	// At each node, we go down into the last child whose rank is not greater than the remaining identifier
+	while( true )
+	{
+		if( m_Data[node].languages != 0 )
+		{
+			if( word_id == 0 )
+				return true;
+
+			word_id--;
+		}
+
+		it  = FirstChild(node);
+		end = it + NbOfChildren(node);
+
+		if( it == end )
+			return false;
+
+		while( it+1 < end && m_Data[it+1].rank <= word_id )
+			it++;
+
+		word_id -= m_Data[it].rank;
+		word.push_back(m_Data[it].value);
+		node = it;
+	}
+}
+
+void CFlatTree::Clear()
+{
+	TFlatNodesList().swap(m_Nodes);
+	m_Data           = NULL;
+	m_NbNodes        = 0;
+	m_NbGarbageNodes = 0;
+	m_NbWords        = 0;
+	m_SharedChildren = false;
+	m_Ranked         = false;
+	m_Transitions.clear();
+}
+
+const uint CFlatTree::NbOfNodes() const
+{
+	return m_NbNodes;
+}
+
+const uint & CFlatTree::NbOfWords() const
+{
+	return m_NbWords;
+}
+
+const size_t CFlatTree::Bytes() const
+{
+	size_t bytes(0);
+
+
+	for( TTransitionsTableCIt it=m_Transitions.begin(); it!=m_Transitions.end(); it++ )
+		bytes += it->size() * sizeof(CTransition);
+
+	// We count the nodes in use, owned or attached (attached nodes are not owned, but they are mapped in memory all the same)
+	return (bytes + size_t(m_NbNodes) * sizeof(CFlatNode));
+}
+
+const size_t CFlatTree::ResidentBytes() const
+{
+	size_t bytes(0);
+
+
+	// Unlike Bytes(), we count the memory held by the vectors, reserved space included
+	for( TTransitionsTableCIt it=m_Transitions.begin(); it!=m_Transitions.end(); it++ )
+		bytes += it->capacity() * sizeof(CTransition);
+
+	if( m_Nodes.empty() )
+		return (bytes + size_t(m_NbNodes) * sizeof(CFlatNode));
+
+	return (bytes + m_Nodes.capacity() * sizeof(CFlatNode));
+}
@@ -68,7 +68,7 @@ bool CGridFileIOXML::_ParseGrid( xmlNodePtr node, CGrid & grid, std::string & la
 			grid = CGrid(dim, size);
 
 			for( uint k=0; k<vec_letters.size(); k++ )
-				grid(k) = vec_letters[k];
+				grid.Letter(k, vec_letters[k]);
 
 			res = true;
 		}
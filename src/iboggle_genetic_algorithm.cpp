@@ -89,38 +89,39 @@ void CIBoggleGeneticAlgorithm::Compute( CGrid & grid, CLexicographicTree & tree
 		{
 			if( j != best_solution )
 			{
-				for( CCoordsIterator p(population[j].Begin()); p!=population[j].End(); p++ )
+				for( uint p=0; p<population[j].TotalSize(); p++ )
 				{
-					// Crossover
+					// Crossover. The grids of the population are copies of the same grid, so they share the identifiers 
+					// of their letters.
 					if( Random() == 1 )
 					{
-						if( population[j](*p) != population[best_solution](*p) )
+						if( population[j].Tile(p) != population[best_solution].Tile(p) )
 						{
-							for( CCoordsIterator q(population[j].Begin()); q!=population[j].End(); q++ )
+							for( uint q=0; q<population[j].TotalSize(); q++ )
 							{
-								if( population[j](*q) == population[best_solution](*p) )
+								if( population[j].Tile(q) == population[best_solution].Tile(p) )
 								{
-									population[j](*q) = population[j](*p);
+									population[j].Tile(q, population[j].Tile(p));
 									break;
 								}
 							}
 
-							population[j](*p) = population[best_solution](*p);
+							population[j].Tile(p, population[best_solution].Tile(p));
 						}
 					}
 
 					// Mutation
 					if( Random(0.0f, 1.0f) < 0.1f )
 					{
-						CCoords q;
+						uint q;
 
 						do
 						{
-							q = population[j].RandomPoint();
+							q = population[j].RandomCell();
 						}
-						while( *p == q );
+						while( p == q );
 
-						population[j].Swap(*p, q);
+						population[j].Swap(p, q);
 					}
 				}
 			}
@@ -40,23 +40,23 @@ void CIBoggleHillClimbing::Compute( CGrid & grid, CLexicographicTree & tree )
 
 		max_score = new_score;
 
-		for( CCoordsIterator p=grid.Begin(); p!=grid.End(); p++ )
+		for( uint p=0; p<grid.TotalSize(); p++ )
 		{
-			CGrid::TCoordsList neighbors = grid.NegativeHalfNeighbors(*p, 1);
+			CGrid::TCellsList neighbors = grid.NegativeHalfNeighbors(p, 1);
 
-			for( CGrid::TCoordsListIt q(neighbors.begin()); q!=neighbors.end(); q++ )
+			for( CGrid::TCellsListCIt q(neighbors.begin()); q!=neighbors.end(); q++ )
 			{
-				grid.Swap(*p, *q);
+				grid.Swap(p, *q);
 				tree.Solve(grid);
 				current_score = tree.Score();
 
 				if( current_score > max_score )
 				{
 					max_score = current_score;
-					best_swap = CSwap(*p, *q);
+					best_swap = CSwap(p, *q);
 				}
 
-				grid.Swap(*p, *q);
+				grid.Swap(p, *q);
 			}
 		}
 
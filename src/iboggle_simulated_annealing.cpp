@@ -36,12 +36,12 @@ void CIBoggleSimulatedAnnealing::Compute( CGrid & grid, CLexicographicTree & tre
 
 	for( int t=0; t<max_temperature; t++ )
 	{
-		CCoords p, q;
+		uint p, q;
 
 		do
 		{
-			p = grid.RandomPoint();
-			q = grid.RandomPoint();
+			p = grid.RandomCell();
+			q = grid.RandomCell();
 		}
 		while( p == q );
 
@@ -20,7 +20,7 @@
 #include "language_config.h"
 
 
-CLanguageConfig::CLanguageConfig(){}
+CLanguageConfig::CLanguageConfig() : m_CaseFolding(false){}
 
 CLanguageConfig::~CLanguageConfig(){}
 
@@ -54,6 +54,26 @@ void CLanguageConfig::Language( const std::string & language )
 	m_Language = language;
 }
 
+void CLanguageConfig::CaseFolding( const bool case_folding )
+{
+	m_CaseFolding = case_folding;
+}
+
+const bool & CLanguageConfig::CaseFolding() const
+{
+	return m_CaseFolding;
+}
+
+void CLanguageConfig::StrippedCharacters( const std::string & stripped_characters )
+{
+	m_StrippedCharacters = stripped_characters;
+}
+
+const std::string & CLanguageConfig::StrippedCharacters() const
+{
+	return m_StrippedCharacters;
+}
+
 void CLanguageConfig::AddLetter( const TWordType & letter, const uint weight )
 {
 	m_Letters.push_back(letter);
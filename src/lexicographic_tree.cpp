@@ -18,13 +18,19 @@
 */
 
 #include <stdexcept>
+#include <cstring>
 #include "utils.h"
+#include "file.h"
 #include "lexicographic_tree.h"
 
 
-CLexicographicTree::CLexicographicTree() : TTreeChar(new TNodeChar(0)), m_PeriodicBorders(false){}
+CLexicographicTree::CLexicographicTree() : TTreeChar(new TNodeChar(0)), m_NbLanguages(1), m_MaxTileLength(1), m_Languages(CFlatTree::ALL_LANGUAGES), m_PeriodicBorders(false), m_Minimize(false), m_GridPruning(false), m_Succinct(false){}
 
-CLexicographicTree::~CLexicographicTree(){}
+CLexicographicTree::~CLexicographicTree()
+{
+	// The nodes under the root belong to the pool
+	m_Root->Children(TNodesList());
+}
 
 void CLexicographicTree::PeriodicBorders( const bool periodic_borders )
 {
@@ -36,9 +42,87 @@ const bool & CLexicographicTree::PeriodicBorders() const
 	return m_PeriodicBorders;
 }
 
-void CLexicographicTree::_InsertNode( TNodeChar *node, const TWordType & word, const uint position )
+void CLexicographicTree::Minimize( const bool minimize )
+{
+	m_Minimize = minimize;
+}
+
+const bool & CLexicographicTree::Minimize() const
+{
+	return m_Minimize;
+}
+
+void CLexicographicTree::GridPruning( const bool grid_pruning )
+{
+	m_GridPruning = grid_pruning;
+}
+
+const bool & CLexicographicTree::GridPruning() const
+{
+	return m_GridPruning;
+}
+
+void CLexicographicTree::Succinct( const bool succinct )
+{
+	m_Succinct = succinct;
+}
+
+const bool & CLexicographicTree::Succinct() const
+{
+	return m_Succinct;
+}
+
+const size_t CLexicographicTree::Bytes() const
+{
+	if( m_SuccinctTree.NbOfNodes() > 0 )
+		return m_SuccinctTree.Bytes();
+
+	return m_FlatTree.Bytes();
+}
+
+CTreeStats CLexicographicTree::Stats() const
+{
+	CTreeStats stats;
+
+
+	if( m_SuccinctTree.NbOfNodes() > 0 )
+	{
+		_Stats(m_SuccinctTree, stats);
+		stats.NbOfStoredNodes(m_SuccinctTree.NbOfNodes());
+	}
+	else if( m_FlatTree.NbOfNodes() > 0 )
+	{
+		_Stats(m_FlatTree, stats);
+		stats.NbOfStoredNodes(m_FlatTree.NbOfNodes());
+	}
+
+	// The pruned copy of the tree and the bitset of found words are also kept between two solvings. The resident bytes 
+	// count what the process holds, reserved space included, whereas the bytes per node only count what is used.
+	stats.TreeBytes(Bytes());
+	stats.ResidentBytes((m_SuccinctTree.NbOfNodes() > 0 ? m_SuccinctTree.Bytes() : m_FlatTree.ResidentBytes()) + m_View.ResidentBytes() + 
+			    m_FoundWords.capacity() * sizeof(uint));
+
+	return stats;
+}
+
+void CLexicographicTree::Languages( const CFlatTree::TLanguagesMask languages )
 {
-	m_LastNodes.push_back(node);
+	m_Languages = languages;
+}
+
+const CFlatTree::TLanguagesMask & CLexicographicTree::Languages() const
+{
+	return m_Languages;
+}
+
+const uint & CLexicographicTree::NbOfLanguages() const
+{
+	return m_NbLanguages;
+}
+
+void CLexicographicTree::_InsertNode( CShard & shard, TNodeChar *node, const TWordType & word, const uint position )
+{
+	shard.last_nodes.push_back(node);
 
 	if( position >= word.size() )
 		return;
@@ -48,8 +132,8 @@ void CLexicographicTree::_InsertNode( TNodeChar *node, const TWordType & word, c
 
 	if( (it = node->ChildrenValue(word[position])) == node->End() )
 	{
-		node->AddChild(new TNodeChar(word[position], (diff_position == 1)));
-		_InsertNode(*(node->End()-1), word, position+1);
+		node->AddChild(shard.pool.New(TNodeChar(word[position], (diff_position == 1))));
+		_InsertNode(shard, *(node->End()-1), word, position+1);
 	}
 	else
 	{
@@ -60,112 +144,524 @@ void CLexicographicTree::_InsertNode( TNodeChar *node, const TWordType & word, c
 			(*it)->IsTerminal(true);
 		}
 
-		_InsertNode(*it, word, position+1);
+		_InsertNode(shard, *it, word, position+1);
+	}
+}
+
+void CLexicographicTree::_ReplaceOrRegister( CShard & shard, const uint depth )
+{
+	TNodeChar *node(NULL), *parent(NULL);
+	TRegisterIt it;
+
+
+	//------------------------------------------------------------------------------------------------------------
+	// Words being inserted in increasing order, the nodes of the last word deeper than 'depth' will never get new 
+	// children. From the deepest one, each of them is either replaced by an equivalent node of the register (its 
+	// children being already unique, a plain comparison is enough) or added to the register.
+	//------------------------------------------------------------------------------------------------------------
+	for( uint k=shard.last_nodes.size()-1; k>=depth && k>0; k-- )
+	{
+		node = shard.last_nodes[k];
+
+		if( (it = shard.nodes.find(node)) != shard.nodes.end() )
+		{
+			parent = shard.last_nodes[k-1];
+			*(parent->End()-1) = *it;
+
+			shard.pool.Delete(node);
+		}
+		else
+			shard.nodes.insert(node);
+	}
+}
+
+void CLexicographicTree::_BuildShard( CShard & shard )
+{
+	TNodeChar *node(NULL);
+	int position;
+
+
+	if( shard.words.empty() )
+		return;
+
+	// The minimization needs the words to be sorted and unique. So does a shard whose words have been modified by 
+	// the normalization, which may have created duplicates.
+	if( m_Minimize || shard.normalized )
+	{
+		std::sort(shard.words.begin(), shard.words.end());
+		shard.words.erase(std::unique(shard.words.begin(), shard.words.end()), shard.words.end());
+	}
+
+	// We push the root node of the shard
+	shard.root = shard.pool.New(TNodeChar(0));
+	shard.last_nodes.push_back(shard.root);
+
+	for( TDictionaryCIt it=shard.words.begin(); it!=shard.words.end(); it++ )
+	{
+		//------------------------------------------------------------------------------------------------------------
+		// Strategy: first, we insert a word w1 and we store the path in a list during its insertion. Next, we want 
+		// to insert w2. We compute the last common position (pos) from the left, between w1 and w2. Then, if 
+		// (pos != |w2|-1), we retrieve the corresponding node in the list and we launch insertion from it. Otherwise, 
+		// w2[pos] represents the last character of w2 and we just have to update the state of this node.
+		//------------------------------------------------------------------------------------------------------------
+		position = LastCommonPosition(*it, shard.last_word);
+
+		if( position == int(it->size()-1) )
+			shard.last_nodes[position+1]->IsTerminal(true);
+		else
+		{
+			if( m_Minimize )
+				_ReplaceOrRegister(shard, position+2);
+
+			node = shard.last_nodes[position+1];
+			shard.last_nodes.erase(shard.last_nodes.begin()+position+1, shard.last_nodes.end());
+			_InsertNode(shard, node, *it, position+1);
+		}
+
+		shard.last_word = *it;
+	}
+
+	if( m_Minimize )
+		_ReplaceOrRegister(shard, 1);
+
+	TDictionary().swap(shard.words);
+}
+
+TNodeChar* CLexicographicTree::_Merge( TNodeChar *node, TNodesMap & merged_nodes )
+{
+	TNodesMapCIt it_merged;
+	TRegisterIt it;
+
+
+	if( (it_merged = merged_nodes.find(node)) != merged_nodes.end() )
+		return it_merged->second;
+
+	// Children are merged first, so that comparing the pointers of the children is enough (as in _ReplaceOrRegister)
+	for( TNodesListIt it_child=node->Begin(); it_child<node->End(); it_child++ )
+		*it_child = _Merge(*it_child, merged_nodes);
+
+	if( (it = m_Register.find(node)) != m_Register.end() )
+	{
+		merged_nodes.insert(std::make_pair(node, *it));
+		m_Pool.Delete(node);
+
+		return *it;
+	}
+
+	m_Register.insert(node);
+	merged_nodes.insert(std::make_pair(node, node));
+
+	return node;
+}
+
+void CLexicographicTree::_JoinShards( TShardsList & shards )
+{
+	TNodesMap merged_nodes;
+
+
+	//------------------------------------------------------------------------------------------------------------
+	// The sub-trees of the shards become the children of the root. In a DAWG, each shard has only been minimized 
+	// on its own: equivalent nodes of different shards (typically common suffixes) are merged here into a single 
+	// register, so that the result is the same as a sequential minimization.
+	//------------------------------------------------------------------------------------------------------------
+	for( TShardsListIt it=shards.begin(); it!=shards.end(); it++ )
+	{
+		if( it->root == NULL )
+			continue;
+
+		// The nodes of the shard belong now to the tree
+		m_Pool.Splice(it->pool);
+
+		for( TNodesListCIt it_child=it->root->Begin(); it_child<it->root->End(); it_child++ )
+			m_Root->AddChild(m_Minimize ? _Merge(*it_child, merged_nodes) : *it_child);
+
+		m_Pool.Delete(it->root);
+		it->root = NULL;
+		it->nodes.clear();
+	}
+}
+
+void CLexicographicTree::_ReleaseNodes()
+{
+	// All the nodes but the root are released at once with the pool, even those shared by several parents in a DAWG
+	m_Register.clear();
+	m_Root->Children(TNodesList());
+	m_Pool.Clear();
+}
+
+template<typename Tree> void CLexicographicTree::_Stats( const Tree & tree, const typename Tree::TIndex node, const uint depth, CTreeStats & stats ) const
+{
+	typename Tree::TIndex it(tree.FirstChild(node)), end(it + tree.NbOfChildren(node));
+
+
+	stats.AddNode(depth, end-it, tree.IsTerminal(node));
+
+	for( ; it<end; it++ )
+		_Stats(tree, it, depth+1, stats);
+}
+
+template<typename Tree> void CLexicographicTree::_Stats( const Tree & tree, CTreeStats & stats ) const
+{
+	const typename Tree::TIndex first_child(tree.FirstChild(tree.Root()));
+	const int nb_children(tree.NbOfChildren(tree.Root()));
+
+
+	stats.AddNode(0, nb_children, tree.IsTerminal(tree.Root()));
+
+	// The sub-trees of the root are browsed in parallel, each thread gathering its own statistics
+	#pragma omp parallel
+	{
+		CTreeStats local_stats;
+
+		#pragma omp for schedule(dynamic)
+		for( int k=0; k<nb_children; k++ )
+			_Stats(tree, first_child+k, 1, local_stats);
+
+		#pragma omp critical
+		{
+			stats.Merge(local_stats);
+		}
 	}
 }
 
-void CLexicographicTree::_SaveWords( std::ofstream & fp, const TNodeChar *node, const TWordType & word ) const
+template<typename Tree> void CLexicographicTree::_SaveWords( std::ofstream & fp, const Tree & tree, const typename Tree::TIndex node, const TWordType & word ) const
 {
-	if( node->IsTerminal() )
+	typename Tree::TIndex it(tree.FirstChild(node)), end(it + tree.NbOfChildren(node));
+
+
+	if( tree.IsTerminal(node) )
 		fp << word << endl;
 
-	for( TNodesListCIt it=node->Begin(); it<node->End(); it++ )
-		_SaveWords(fp, *it, word+(*it)->Value());
+	for( ; it<end; it++ )
+		_SaveWords(fp, tree, it, word+m_Alphabet.Letter(tree.Value(it)));
 }
 
-const uint CLexicographicTree::_GetNumberOfWords( TNodeChar *node ) const
+const uint CLexicographicTree::_GetNumberOfWords( const CFlatTree::TIndex node ) const
 {
+	CFlatTree::TIndex it(m_FlatTree.FirstChild(node)), end(it + m_FlatTree.NbOfChildren(node));
 	uint sum(0);
 
 
-	if( node->IsTerminal() )
+	if( m_FlatTree.IsTerminal(node) )
 		sum++;
 
-	for( TNodesListCIt it=node->Begin(); it<node->End(); it++ )
-		sum += _GetNumberOfWords(*it);
+	for( ; it<end; it++ )
+		sum += _GetNumberOfWords(it);
 
 	return sum;
 }
 
-TNodeChar* CLexicographicTree::_ChildrenWord( TNodeChar* node, const TWordType & word, const uint position ) const
+void CLexicographicTree::_Freeze()
 {
-	if( position >= word.size() )
-		return node;
+	// We build the flat tree used by the solver, then we release the nodes which were only needed during the insertion
+	m_FlatTree.Build(m_Root, m_Alphabet, (m_Minimize ? m_Register.size()+1 : Size()), m_Minimize, m_NbLanguages);
+	_ReleaseNodes();
+}
 
-	TNodesListCIt it;
+const bool CLexicographicTree::_LoadImage( const std::string & image_filename, const uint min_word_length, const uint max_word_length )
+{
+	const CImageHeader *header(NULL);
+
+
+	if( !m_Image.Open(image_filename) )
+		return false;
+
+	// We check that the image has been compiled by this version, for this platform and that it is complete
+	header = reinterpret_cast<const CImageHeader*>(m_Image.Data());
+
+	if( m_Image.Size() < sizeof(CImageHeader) || 
+	    std::memcmp(header->magic, IMAGE_MAGIC, sizeof(header->magic)) != 0 || 
+	    header->version != IMAGE_VERSION || 
+	    header->node_size != sizeof(CFlatTree::CFlatNode) || 
+	    header->nb_nodes == 0 || 
+	    m_Image.Size() != sizeof(CImageHeader) + size_t(header->nb_nodes) * header->node_size || 
+	    header->alphabet_size > CAlphabet::NONE || 
+	    header->nb_languages == 0 || 
+	    header->nb_languages > CFlatTree::MAX_LANGUAGES )
+	{
+		m_Image.Close();
+		return false;
+	}
+
+	if( min_word_length < header->min_word_length || max_word_length > header->max_word_length )
+		throw std::logic_error("the dictionary image has been compiled for words of length " + ToString(header->min_word_length) + " to " + ToString(header->max_word_length));
+
+	m_MinWordLength = min_word_length;
+	m_MaxWordLength = max_word_length;
+	m_NbLanguages   = header->nb_languages;
+	m_Alphabet      = CAlphabet(std::string(header->alphabet, header->alphabet_size));
 
-	if( (it = node->ChildrenValue(word[position])) != node->End() )
-		return _ChildrenWord(*it, word, position+1);
+	// The solver directly works on the mapped nodes
+	m_FlatTree.Attach(m_Image.Data() + sizeof(CImageHeader), header->nb_nodes, header->nb_words);
 
-	return NULL;
+	return true;
 }
 
-const bool CLexicographicTree::Load( const std::string & dict_filename, const uint min_word_length, const uint max_word_length )
+const bool CLexicographicTree::Load( const CLanguageConfig & language_config, const uint min_word_length, const uint max_word_length )
 {
-	std::ifstream fp(dict_filename.c_str());
-	TWordType word;
-	int position;
-	uint word_size;
-	TNode *node(NULL);
-
+	return Load(TLanguageConfigsList(1, language_config), min_word_length, max_word_length);
+}
 
+const bool CLexicographicTree::Load( const TLanguageConfigsList & language_configs, const uint min_word_length, const uint max_word_length )
+{
 	if( min_word_length < 1 )
 		throw std::logic_error("Minimum words length is 1");
 
 	if( min_word_length > max_word_length )
 		throw std::logic_error("Minimum word length must be less or equal than maximum word length");
 
-	if( !fp )
+	if( language_configs.empty() || language_configs.size() > CFlatTree::MAX_LANGUAGES )
+		throw std::logic_error("The number of languages must be between 1 and " + ToString(uint(CFlatTree::MAX_LANGUAGES)));
+
+	// The flat tree may still refer to a previous image
+	m_FlatTree.Clear();
+	m_SuccinctTree.Clear();
+	m_View.Clear();
+	m_ViewCounts.clear();
+	m_Image.Close();
+	m_LanguageConfigs.clear();
+	m_LanguageAlphabets.clear();
+
+	// An image holds its own languages
+	if( language_configs.size() == 1 && AreStringsEqual(CFile(language_configs[0].DictionaryFilename()).Extension(), IMAGE_EXTENSION) )
 	{
-		fp.close();
+		if( !_LoadImage(language_configs[0].DictionaryFilename(), min_word_length, max_word_length) )
+			return false;
+	}
+	else if( !_LoadDictionaries(language_configs, min_word_length, max_word_length) )
 		return false;
+
+	// The flat tree is only kept to build the succinct one, which then replaces it in the solver
+	if( m_Succinct )
+	{
+		m_SuccinctTree.Build(m_FlatTree, m_NbLanguages);
+		m_FlatTree.Clear();
+		m_Image.Close();
+	}
+
+	return true;
+}
+
+const bool CLexicographicTree::_Normalize( const CLanguageConfig & language_config, const CAlphabet & alphabet, TWordType & word ) const
+{
+	const std::string & stripped(language_config.StrippedCharacters());
+	uint size(0);
+
+
+	// We fold the case and remove the stripped characters in place
+	for( uint k=0; k<word.size(); k++ )
+	{
+		const char c(language_config.CaseFolding() ? ToLower(word[k]) : word[k]);
+
+		if( stripped.find(c) == std::string::npos )
+			word[size++] = c;
 	}
 
+	word.resize(size);
+
+	// A word holding a character out of the alphabet of its language can never be found in a grid
+	for( uint k=0; k<word.size(); k++ )
+		if( alphabet.Id(word[k]) == CAlphabet::NONE )
+			return false;
+
+	return true;
+}
+
+const bool CLexicographicTree::_Translate( const TWordType & word, const uint language, CAlphabet::TLetterIdsList & ids ) const
+{
+	TWordType normalized(word);
+
+
+	// A word given at runtime is normalized for a language as the words of its dictionary are
+	if( !_Normalize(m_LanguageConfigs[language], m_LanguageAlphabets[language], normalized) )
+		return false;
+
+	if( normalized.empty() || normalized.size() < m_MinWordLength || normalized.size() > m_MaxWordLength )
+		return false;
+
+	return m_Alphabet.Translate(normalized, ids);
+}
+
+const bool CLexicographicTree::_LoadDictionaries( const TLanguageConfigsList & language_configs, const uint min_word_length, const uint max_word_length )
+{
+	TShardsList shards(NB_SHARDS);
+	TWordType word;
+	uint word_size;
+
+
 	m_MinWordLength = min_word_length;
 	m_MaxWordLength = max_word_length;
+	m_NbLanguages   = language_configs.size();
+	m_Alphabet      = CAlphabet(language_configs);
 
-	// We push the root node
-	m_LastNodes.push_back(m_Root);
+	// The languages are kept to normalize the words added or removed later
+	m_LanguageConfigs = language_configs;
+	m_LanguageAlphabets.clear();
 
-	while( std::getline(fp, word) )
+	for( uint k=0; k<m_NbLanguages; k++ )
 	{
-		word_size = word.size();
+		std::ifstream fp(language_configs[k].DictionaryFilename().c_str());
+		const CAlphabet alphabet(language_configs[k]);
+
+
+		m_LanguageAlphabets.push_back(alphabet);
+
+		if( !fp )
+			return false;
 
-		if( word_size > 0 && word_size >= min_word_length && word_size <= max_word_length )
+		while( std::getline(fp, word) )
 		{
+			// Only words which may be found take place in the tree
+			if( !_Normalize(language_configs[k], alphabet, word) )
+				continue;
+
+			word_size = word.size();
+
 			//------------------------------------------------------------------------------------------------------------
-			// Strategy: first, we insert a word w1 and we store the path in a list during its insertion. Next, we want 
-			// to insert w2. We compute the last common position (pos) from the left, between w1 and w2. Then, if 
-			// (pos != |w2|-1), we retrieve the corresponding node in the list and we launch insertion from it. Otherwise, 
-			// w2[pos] represents the last character of w2 and we just have to update the state of this node.
+			// With several languages, we append to each word the index of its language plus one, which cannot be a 
+			// character of the alphabet. A word then ends with one node per language accepting it: these nodes are 
+			// turned into a mask when the tree is frozen. In a DAWG, only nodes of words with the same languages are 
+			// merged.
 			//------------------------------------------------------------------------------------------------------------
-			position = LastCommonPosition(word, m_LastWord);
-
-			if( position == int(word.size()-1) )
-				m_LastNodes[position+1]->IsTerminal(true);
-			else
+			if( word_size > 0 && word_size >= min_word_length && word_size <= max_word_length )
 			{
-				node = m_LastNodes[position+1];
-				m_LastNodes.erase(m_LastNodes.begin()+position+1, m_LastNodes.end());
-				_InsertNode(node, word, position+1);
-			}
+				CShard & shard(shards[uchar(word[0])]);
 
-			m_LastWord = word;
+				shard.words.push_back(m_NbLanguages > 1 ? word + char(k+1) : word);
+				shard.normalized |= (language_configs[k].CaseFolding() || !language_configs[k].StrippedCharacters().empty());
+			}
 		}
+
+		fp.close();
 	}
 
-	fp.close();
+	//------------------------------------------------------------------------------------------------------------
+	// Words starting with different characters have no node in common but the root, so they are split into 
+	// shards whose sub-trees are built in parallel, then joined under the root. The scheduling is dynamic since 
+	// some initial letters are much more frequent than others.
+	//------------------------------------------------------------------------------------------------------------
+	#pragma omp parallel for schedule(dynamic)
+	for( int k=0; k<int(shards.size()); k++ )
+		_BuildShard(shards[k]);
+
+	_JoinShards(shards);
+	_Freeze();
 
 	return true;
 }
 
 const uint CLexicographicTree::GetNumberOfWords() const
 {
-	return _GetNumberOfWords(m_Root);
+	if( m_SuccinctTree.NbOfNodes() > 0 )
+		return m_SuccinctTree.NbOfWords();
+
+	// Words are counted when they are ranked
+	if( m_FlatTree.IsRanked() )
+		return m_FlatTree.NbOfWords();
+
+	return _GetNumberOfWords(m_FlatTree.Root());
 }
 
 void CLexicographicTree::SaveWords( const std::string & dict_filename ) const
 {
 	std::ofstream fp(dict_filename.c_str());
-	_SaveWords(fp, m_Root, "");
+
+
+	if( m_SuccinctTree.NbOfNodes() > 0 )
+		_SaveWords(fp, m_SuccinctTree, m_SuccinctTree.Root(), "");
+	else
+		_SaveWords(fp, m_FlatTree, m_FlatTree.Root(), "");
+}
+
+const bool CLexicographicTree::SaveImage( const std::string & image_filename ) const
+{
+	std::ofstream fp(image_filename.c_str(), std::ios::out | std::ios::binary);
+	CImageHeader header = { IMAGE_MAGIC, IMAGE_VERSION, sizeof(CFlatTree::CFlatNode), m_FlatTree.NbOfNodes(), m_FlatTree.NbOfWords(), m_MinWordLength, m_MaxWordLength, m_Alphabet.Size(), m_NbLanguages, "" };
+
+
+	// Images hold flat nodes, which are not kept in succinct mode
+	if( !fp || m_FlatTree.NbOfNodes() == 0 )
+		return false;
+
+	m_Alphabet.Letters().copy(header.alphabet, sizeof(header.alphabet));
+
+	fp.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+	return m_FlatTree.Save(fp);
+}
+
+const bool CLexicographicTree::AddWord( const TWordType & word, const CFlatTree::TLanguagesMask languages )
+{
+	CAlphabet::TLetterIdsList ids;
+	bool added(false);
+
+
+	if( m_SuccinctTree.NbOfNodes() > 0 || !m_FlatTree.IsEditable() )
+		throw std::logic_error("Words can only be added to a dictionary which is neither minimized, succinct nor loaded from an image");
+
+	// As in Load, the word is normalized for each language, then ignored if it has a wrong length or cannot be spelled with 
+	// the alphabet of the language. It may thus be inserted differently in each language.
+	for( uint k=0; k<m_LanguageConfigs.size(); k++ )
+		if( (languages & (1u << k)) && _Translate(word, k, ids) && m_FlatTree.Insert(ids, 1u << k) )
+			added = true;
+
+	if( !added )
+		return false;
+
+	// The pruned copy of the tree must be built again
+	m_ViewCounts.clear();
+
+	return true;
+}
+
+const bool CLexicographicTree::RemoveWord( const TWordType & word, const CFlatTree::TLanguagesMask languages )
+{
+	CAlphabet::TLetterIdsList ids;
+	bool removed(false);
+
+
+	if( m_SuccinctTree.NbOfNodes() > 0 || !m_FlatTree.IsEditable() )
+		throw std::logic_error("Words can only be removed from a dictionary which is neither minimized, succinct nor loaded from an image");
+
+	for( uint k=0; k<m_LanguageConfigs.size(); k++ )
+		if( (languages & (1u << k)) && _Translate(word, k, ids) && m_FlatTree.Erase(ids, 1u << k) )
+			removed = true;
+
+	if( !removed )
+		return false;
+
+	m_ViewCounts.clear();
+
+	return true;
+}
+
+TWordType CLexicographicTree::Word( const uint word_id ) const
+{
+	CAlphabet::TLetterIdsList ids;
+	TWordType word;
+
+
+	if( m_SuccinctTree.NbOfNodes() > 0 )
+	{
+		if( !m_SuccinctTree.Word(word_id, ids) )
+			throw std::logic_error("Unknown word identifier " + ToString(word_id));
+	}
+	else if( !m_FlatTree.IsRanked() || !m_FlatTree.Word(word_id, ids) )
+		throw std::logic_error("Unknown word identifier " + ToString(word_id));
+
+	for( CAlphabet::TLetterIdsListCIt it=ids.begin(); it!=ids.end(); it++ )
+		word += m_Alphabet.Letter(*it);
+
+	return word;
+}
+
+CLexicographicTree::TWordsList CLexicographicTree::Words( const TWordIdsList & word_ids ) const
+{
+	TWordsList words;
+
+
+	for( TWordIdsListCIt it=word_ids.begin(); it!=word_ids.end(); it++ )
+		words.insert(Word(*it));
+
+	return words;
 }
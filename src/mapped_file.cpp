@@ -0,0 +1,124 @@
+/*
+    Smoggle - A multidimensional and multi-language boggle solver
+    Copyright (C) 2009 - Nicolas Lermé <nicolas.lerme@free.fr>
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef _WIN32
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <fcntl.h>
+#	include <unistd.h>
+#endif
+#include "mapped_file.h"
+
+
+#ifndef _WIN32
+CMappedFile::CMappedFile() : m_Data(NULL), m_Size(0){}
+#else
+CMappedFile::CMappedFile() : m_Data(NULL), m_Size(0), m_File(INVALID_HANDLE_VALUE), m_Mapping(NULL){}
+#endif
+
+CMappedFile::~CMappedFile()
+{
+	Close();
+}
+
+bool CMappedFile::Open( const std::string & filename )
+{
+	Close();
+
+	#ifndef _WIN32
+		struct stat infos;
+		void *data;
+		int fd(open(filename.c_str(), O_RDONLY));
+
+		if( fd < 0 )
+			return false;
+
+		if( fstat(fd, &infos) != 0 || infos.st_size == 0 )
+		{
+			close(fd);
+			return false;
+		}
+
+		// The mapping stays valid once the descriptor is closed
+		data = mmap(NULL, infos.st_size, PROT_READ, MAP_SHARED, fd, 0);
+		close(fd);
+
+		if( data == MAP_FAILED )
+			return false;
+
+		m_Data = static_cast<const char*>(data);
+		m_Size = infos.st_size;
+	#else
+		LARGE_INTEGER size;
+
+		if( (m_File = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL)) == INVALID_HANDLE_VALUE )
+			return false;
+
+		if( !GetFileSizeEx(m_File, &size) || size.QuadPart == 0 || (m_Mapping = CreateFileMappingA(m_File, NULL, PAGE_READONLY, 0, 0, NULL)) == NULL )
+		{
+			Close();
+			return false;
+		}
+
+		if( (m_Data = static_cast<const char*>(MapViewOfFile(m_Mapping, FILE_MAP_READ, 0, 0, 0))) == NULL )
+		{
+			Close();
+			return false;
+		}
+
+		m_Size = size_t(size.QuadPart);
+	#endif
+
+	return true;
+}
+
+void CMappedFile::Close()
+{
+	#ifndef _WIN32
+		if( m_Data != NULL )
+			munmap(const_cast<char*>(m_Data), m_Size);
+	#else
+		if( m_Data != NULL )
+			UnmapViewOfFile(m_Data);
+
+		if( m_Mapping != NULL )
+			CloseHandle(m_Mapping), m_Mapping=NULL;
+
+		if( m_File != INVALID_HANDLE_VALUE )
+			CloseHandle(m_File), m_File=INVALID_HANDLE_VALUE;
+	#endif
+
+	m_Data = NULL;
+	m_Size = 0;
+}
+
+const bool CMappedFile::IsOpen() const
+{
+	return (m_Data != NULL);
+}
+
+const char* CMappedFile::Data() const
+{
+	return m_Data;
+}
+
+const size_t CMappedFile::Size() const
+{
+	return m_Size;
+}
@@ -35,8 +35,9 @@ float CPath::MeanCurvature() const
 	float mean_curv(0.0f);
 
 
-	// We check if we have at least three nodes in the path
-	assert(m_Nodes.size()>=3);
+	// A path of less than three nodes is straight. This happens when a tile holds several letters.
+	if( m_Nodes.size() < 3 )
+		return 0.0f;
 
 	// We compute the curvature
 	for( TCoordsListCIt it(m_Nodes.begin()+1); it<(m_Nodes.end()-1); it++ )
@@ -50,8 +51,9 @@ float CPath::MaxCurvature() const
 	float max_curv(0.0f);
 
 
-	// We check if we have at least three nodes in the path
-	assert(m_Nodes.size()>=3);
+	// A path of less than three nodes is straight. This happens when a tile holds several letters.
+	if( m_Nodes.size() < 3 )
+		return 0.0f;
 
 	// We compute the curvature
 	for( TCoordsListCIt it(m_Nodes.begin()+1); it<(m_Nodes.end()-1); it++ )
@@ -0,0 +1,99 @@
+/*
+    Smoggle - A multidimensional and multi-language boggle solver
+    Copyright (C) 2009 - Nicolas Lermé <nicolas.lerme@free.fr>
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <algorithm>
+#include "succinct_tree.h"
+
+
+CSuccinctTree::CSuccinctTree(){}
+
+CSuccinctTree::~CSuccinctTree(){}
+
+void CSuccinctTree::Build( const CFlatTree & tree, const uint nb_languages )
+{
+	CFlatTree::TIndexesList queue(1, tree.Root());
+	CFlatTree::TIndex it, end;
+
+
+	Clear();
+
+	// Nodes are browsed in breadth-first order. The queue holds the indexes of the nodes in the flat tree, which
+	// may appear several times when blocks are shared.
+	for( uint k=0; k<queue.size(); k++ )
+	{
+		m_Values.push_back(tree.Value(queue[k]));
+		m_Terminals.PushBack(tree.IsTerminal(queue[k]));
+
+		if( nb_languages > 1 && tree.IsTerminal(queue[k]) )
+			m_Languages.push_back(tree.Languages(queue[k]));
+
+		for( it=tree.FirstChild(queue[k]), end=it+tree.NbOfChildren(queue[k]); it<end; it++ )
+		{
+			m_Degrees.PushBack(true);
+			queue.push_back(it);
+		}
+
+		m_Degrees.PushBack(false);
+	}
+
+	m_Degrees.Build();
+	m_Terminals.Build();
+}
+
+bool CSuccinctTree::Word( const uint word_id, CAlphabet::TLetterIdsList & word ) const
+{
+	TIndex node;
+
+
+	word.clear();
+
+	if( word_id >= NbOfWords() )
+		return false;
+
+	// We go up from the terminal node to the root
+	for( node=m_Terminals.Select1(word_id); node!=Root(); node=Parent(node) )
+		word.push_back(m_Values[node]);
+
+	std::reverse(word.begin(), word.end());
+
+	return true;
+}
+
+void CSuccinctTree::Clear()
+{
+	m_Degrees.Clear();
+	m_Terminals.Clear();
+	TValuesList().swap(m_Values);
+	TLanguagesList().swap(m_Languages);
+}
+
+const uint CSuccinctTree::NbOfNodes() const
+{
+	return m_Values.size();
+}
+
+const uint & CSuccinctTree::NbOfWords() const
+{
+	return m_Terminals.NbOfOnes();
+}
+
+const size_t CSuccinctTree::Bytes() const
+{
+	return (m_Degrees.Bytes() + m_Terminals.Bytes() + m_Values.size() * sizeof(TLetterId) + m_Languages.size() * sizeof(TLanguagesMask));
+}
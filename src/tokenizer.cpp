@@ -38,6 +38,12 @@ bool CColon::operator () ( char c ) const
 	return (c == ':');
 }
 
+//----------------------------------------- CComma class -----------------------------------------
+bool CComma::operator () ( char c ) const
+{
+	return (c == ',');
+}
+
 //--------------------------------------- CSeparator class ---------------------------------------
 CSeparator::CSeparator( const std::string & str ) : m_String(str){}
 
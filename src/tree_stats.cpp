@@ -0,0 +1,183 @@
+/*
+    Smoggle - A multidimensional and multi-language boggle solver
+    Copyright (C) 2009 - Nicolas Lermé <nicolas.lerme@free.fr>
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <iomanip>
+#include "tree_stats.h"
+
+
+CTreeStats::CTreeStats() : m_NbStoredNodes(0), m_TreeBytes(0), m_ResidentBytes(0){}
+
+CTreeStats::~CTreeStats(){}
+
+void CTreeStats::AddNode( const uint depth, const uint nb_children, const bool is_terminal )
+{
+	if( depth >= m_Nodes.size() )
+	{
+		m_Nodes.resize(depth+1, 0);
+		m_Terminals.resize(depth+1, 0);
+		m_Branching.resize(depth+1);
+	}
+
+	if( nb_children >= m_Branching[depth].size() )
+		m_Branching[depth].resize(nb_children+1, 0);
+
+	m_Nodes[depth]++;
+	m_Branching[depth][nb_children]++;
+
+	if( is_terminal )
+		m_Terminals[depth]++;
+}
+
+void CTreeStats::Merge( const CTreeStats & other )
+{
+	for( uint depth=0; depth<other.m_Nodes.size(); depth++ )
+	{
+		if( depth >= m_Nodes.size() )
+		{
+			m_Nodes.resize(depth+1, 0);
+			m_Terminals.resize(depth+1, 0);
+			m_Branching.resize(depth+1);
+		}
+
+		if( other.m_Branching[depth].size() > m_Branching[depth].size() )
+			m_Branching[depth].resize(other.m_Branching[depth].size(), 0);
+
+		m_Nodes[depth]     += other.m_Nodes[depth];
+		m_Terminals[depth] += other.m_Terminals[depth];
+
+		for( uint k=0; k<other.m_Branching[depth].size(); k++ )
+			m_Branching[depth][k] += other.m_Branching[depth][k];
+	}
+}
+
+void CTreeStats::Clear()
+{
+	m_Nodes.clear();
+	m_Terminals.clear();
+	m_Branching.clear();
+	m_NbStoredNodes = 0;
+	m_TreeBytes     = 0;
+	m_ResidentBytes = 0;
+}
+
+void CTreeStats::NbOfStoredNodes( const uint nb_stored_nodes )
+{
+	m_NbStoredNodes = nb_stored_nodes;
+}
+
+const uint & CTreeStats::NbOfStoredNodes() const
+{
+	return m_NbStoredNodes;
+}
+
+void CTreeStats::TreeBytes( const size_t tree_bytes )
+{
+	m_TreeBytes = tree_bytes;
+}
+
+const size_t & CTreeStats::TreeBytes() const
+{
+	return m_TreeBytes;
+}
+
+void CTreeStats::ResidentBytes( const size_t resident_bytes )
+{
+	m_ResidentBytes = resident_bytes;
+}
+
+const size_t & CTreeStats::ResidentBytes() const
+{
+	return m_ResidentBytes;
+}
+
+const ullong CTreeStats::NbOfNodes() const
+{
+	ullong sum(0);
+
+
+	for( TCountsListCIt it=m_Nodes.begin(); it!=m_Nodes.end(); it++ )
+		sum += *it;
+
+	return sum;
+}
+
+const ullong CTreeStats::NbOfTerminals() const
+{
+	ullong sum(0);
+
+
+	for( TCountsListCIt it=m_Terminals.begin(); it!=m_Terminals.end(); it++ )
+		sum += *it;
+
+	return sum;
+}
+
+const uint CTreeStats::Height() const
+{
+	return (m_Nodes.empty() ? 0 : m_Nodes.size()-1);
+}
+
+const CTreeStats::TCountsList & CTreeStats::Nodes() const
+{
+	return m_Nodes;
+}
+
+const CTreeStats::TCountsList & CTreeStats::Terminals() const
+{
+	return m_Terminals;
+}
+
+const CTreeStats::THistogramsList & CTreeStats::Branching() const
+{
+	return m_Branching;
+}
+
+void CTreeStats::Print( std::ostream & out ) const
+{
+	const ullong nb_nodes(NbOfNodes()), nb_terminals(NbOfTerminals());
+
+
+	out << "\n---- Dictionary statistics ----\n";
+	out << "* Stored nodes     : " << m_NbStoredNodes << '\n';
+	out << "* Bytes per node   : " << (m_NbStoredNodes > 0 ? double(m_TreeBytes) / m_NbStoredNodes : 0.0) << '\n';
+	out << "* Tree bytes       : " << m_TreeBytes << '\n';
+	out << "* Resident bytes   : " << m_ResidentBytes << '\n';
+	out << "* Trie nodes       : " << nb_nodes << '\n';
+	out << "* Words            : " << nb_terminals << '\n';
+	out << "* Terminal density : " << (nb_nodes > 0 ? double(nb_terminals) / nb_nodes : 0.0) << '\n';
+	out << "* Height           : " << Height() << "\n\n";
+
+	// One line per depth: number of nodes, terminal density, then the number of nodes having k children for each k
+	out << "depth      nodes  density  branching (children:nodes)\n";
+
+	for( uint depth=0; depth<m_Nodes.size(); depth++ )
+	{
+		out << std::setw(5) << depth << ' ' << std::setw(10) << m_Nodes[depth] << ' ' 
+		    << std::setw(8) << std::fixed << std::setprecision(3) << (m_Nodes[depth] > 0 ? double(m_Terminals[depth]) / m_Nodes[depth] : 0.0) << ' ';
+
+		for( uint k=0; k<m_Branching[depth].size(); k++ )
+			if( m_Branching[depth][k] > 0 )
+				out << ' ' << k << ':' << m_Branching[depth][k];
+
+		out << '\n';
+	}
+
+	out.unsetf(std::ios::floatfield);
+	out << std::setprecision(6) << "-------------------------------\n";
+}
@@ -0,0 +1,107 @@
+/*
+    Smoggle - A multidimensional and multi-language boggle solver
+    Copyright (C) 2009 - Nicolas Lerm <nicolas.lerme@free.fr>
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <cmath>
+#include <vector>
+#include <stdexcept>
+#include "grid_file_io_xml.h"
+#include "test_utils.h"
+
+#define DICT_FILENAME   std::string("data/british_dict.txt")
+#define GRID_FILENAME   std::string("data/grid.xml")
+#define MIN_WORD_LENGTH 3
+#define MAX_WORD_LENGTH 1000
+
+
+typedef std::vector<CGrid>         TGridsList;
+typedef TGridsList::const_iterator TGridsListCIt;
+
+
+//----------------------------------------------------------------------------------------------------------------
+// We check that a backend holds exactly the words of the plain tree, and that it gives the same resolutions of 
+// fixed grids, with and without periodic borders.
+//----------------------------------------------------------------------------------------------------------------
+bool CheckBackend( CLexicographicTree & tree, CLexicographicTree & plain, const TGridsList & grids, const std::string & what )
+{
+	bool ok(tree.GetNumberOfWords() == plain.GetNumberOfWords() && StoredWords(tree) == StoredWords(plain));
+
+
+	for( TGridsListCIt it=grids.begin(); it!=grids.end(); it++ )
+	{
+		for( uint periodic=0; periodic<2; periodic++ )
+		{
+			tree.PeriodicBorders(periodic);
+			plain.PeriodicBorders(periodic);
+
+			if( tree.Words(tree.Solve(*it)) != plain.Words(plain.Solve(*it)) || tree.Score() != plain.Score() || 
+			    std::fabs(tree.MeanCurvature() - plain.MeanCurvature()) > 1e-5f )
+				ok = false;
+		}
+	}
+
+	return Report(what + " gives the words of the plain tree", ok);
+}
+
+int main()
+{
+	const std::string image_filename(TEST_TMP_DIR + "dictionary_backends.img"), dawg_image_filename(TEST_TMP_DIR + "dictionary_backends_dawg.img");
+	CLexicographicTree plain, dawg, image, dawg_image, succinct;
+	CGridFileIOXML grid_io;
+	TGridsList grids(1);
+	std::string language;
+	bool ok(true);
+
+
+	try
+	{
+		// The grids hold words of several lengths in 2D and 3D, and one of them holds a tile of two letters
+		if( !grid_io.Load(GRID_FILENAME, grids[0], language) )
+			throw std::logic_error("cannot load " + GRID_FILENAME);
+
+		grids.push_back(TestGrid(2, 4, "serstalnietdoprm"));
+		grids.push_back(TestGrid(3, 3, "tgqeeprlnuvehunialesernrs"));
+		grids.push_back(TestGrid(2, 4, "aeinqrstlodcmpgu"));
+		grids.back().Letter(4, "qu");
+
+		plain.Load(TestConfig(DICT_FILENAME), MIN_WORD_LENGTH, MAX_WORD_LENGTH);
+		ok &= Report("words found in the grids", plain.Words(plain.Solve(grids[1])).size() > 10);
+
+		dawg.Minimize(true);
+		dawg.Load(TestConfig(DICT_FILENAME), MIN_WORD_LENGTH, MAX_WORD_LENGTH);
+		ok &= CheckBackend(dawg, plain, grids, "DAWG");
+
+		// The images are mapped back from the compiled trees
+		ok &= Report("images saved", plain.SaveImage(image_filename) && dawg.SaveImage(dawg_image_filename));
+		image.Load(TestConfig(image_filename), MIN_WORD_LENGTH, MAX_WORD_LENGTH);
+		ok &= CheckBackend(image, plain, grids, "image");
+		dawg_image.Load(TestConfig(dawg_image_filename), MIN_WORD_LENGTH, MAX_WORD_LENGTH);
+		ok &= CheckBackend(dawg_image, plain, grids, "image of the DAWG");
+
+		succinct.Succinct(true);
+		succinct.Load(TestConfig(DICT_FILENAME), MIN_WORD_LENGTH, MAX_WORD_LENGTH);
+		ok &= CheckBackend(succinct, plain, grids, "succinct tree");
+	}
+	catch( const std::exception & e )
+	{
+		std::cout << "  error: " << e.what() << '\n';
+		ok = false;
+	}
+
+	return (ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,148 @@
+/*
+    Smoggle - A multidimensional and multi-language boggle solver
+    Copyright (C) 2009 - Nicolas Lerm <nicolas.lerme@free.fr>
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <vector>
+#include <stdexcept>
+#include "test_utils.h"
+
+#define MIN_WORD_LENGTH 3
+#define MAX_WORD_LENGTH 1000
+
+
+//----------------------------------------------------------------------------------------------------------------
+// We check a tree edited in place against a tree freshly loaded from the same words: same words, same identifiers 
+// once ranked and same resolutions of a grid, with and without grid pruning. The difference between the numbers 
+// of their stored nodes is the number of garbage nodes of the edited tree.
+//----------------------------------------------------------------------------------------------------------------
+bool CheckEdit( CLexicographicTree & tree, const TWordsList & words, const CGrid & grid, const std::string & step, uint & garbage )
+{
+	const std::string dict_filename(TEST_TMP_DIR + "dictionary_edit_fresh.txt");
+	CLexicographicTree fresh;
+	bool ok(true);
+
+
+	SaveDictionary(words, dict_filename);
+	fresh.Load(TestConfig(dict_filename), MIN_WORD_LENGTH, MAX_WORD_LENGTH);
+
+	if( tree.GetNumberOfWords() != words.size() || fresh.GetNumberOfWords() != words.size() || StoredWords(tree) != words )
+		ok = false;
+
+	for( uint pruning=0; pruning<2; pruning++ )
+	{
+		tree.GridPruning(pruning);
+		fresh.GridPruning(pruning);
+
+		if( tree.Words(tree.Solve(grid)) != fresh.Words(fresh.Solve(grid)) || tree.Score() != fresh.Score() )
+			ok = false;
+	}
+
+	// Both trees have been ranked by the resolutions
+	for( uint id=0; id<words.size(); id++ )
+		if( tree.Word(id) != fresh.Word(id) )
+			ok = false;
+
+	garbage = tree.Stats().NbOfStoredNodes() - fresh.Stats().NbOfStoredNodes();
+
+	return Report(step, ok);
+}
+
+// Words can only be edited in a tree whose nodes are neither shared, succinct nor mapped from an image
+bool CheckReadOnly( CLexicographicTree & tree, const std::string & what )
+{
+	bool add(false), remove(false);
+
+
+	try { tree.AddWord("cats"); } catch( const std::logic_error & e ) { add = true; }
+	try { tree.RemoveWord("cat"); } catch( const std::logic_error & e ) { remove = true; }
+
+	return Report(what + " is read-only", add && remove);
+}
+
+int main()
+{
+	const char* initial_words[] = { "car", "cart", "care", "cat", "dog", "dot", "door", "bird", "bit", "bite", "tree", "tea", 
+					"ten", "tent", "rat", "rate", "red", "rest", "sea", "seat", "set", "sit" };
+	const char* erased_words[]  = { "dot", "door", "bit", "bite", "tree", "tea", "ten", "tent", "rat", "rate", "red", "rest", 
+					"sea", "seat", "set", "sit", "bird", "dog" };
+	const std::string dict_filename(TEST_TMP_DIR + "dictionary_edit.txt"), image_filename(TEST_TMP_DIR + "dictionary_edit.img");
+	const CGrid grid(TestGrid(2, 4, "carsdtebogirxydz"));
+	TWordsList words(initial_words, initial_words + sizeof(initial_words)/sizeof(initial_words[0]));
+	CLexicographicTree tree, dawg, image, succinct;
+	uint garbage(0), max_garbage(0);
+	bool ok(true), compacted(false);
+
+
+	try
+	{
+		SaveDictionary(words, dict_filename);
+		tree.Load(TestConfig(dict_filename), MIN_WORD_LENGTH, MAX_WORD_LENGTH);
+		ok &= CheckEdit(tree, words, grid, "loaded dictionary", garbage);
+		ok &= Report("words found in the grid", tree.Words(tree.Solve(grid)).size() > 4);
+
+		ok &= Report("insert a word extending a path", tree.AddWord("carts") && words.insert("carts").second);
+		ok &= CheckEdit(tree, words, grid, "  same as a fresh tree", garbage);
+
+		ok &= Report("insert a word on a new branch", tree.AddWord("zebra") && words.insert("zebra").second);
+		ok &= CheckEdit(tree, words, grid, "  same as a fresh tree", garbage);
+
+		ok &= Report("insert a word already there", !tree.AddWord("cart"));
+
+		ok &= Report("erase a leaf word", tree.RemoveWord("carts") && words.erase("carts") == 1);
+		ok &= CheckEdit(tree, words, grid, "  same as a fresh tree", garbage);
+
+		ok &= Report("erase a prefix word", tree.RemoveWord("car") && words.erase("car") == 1);
+		ok &= CheckEdit(tree, words, grid, "  same as a fresh tree", garbage);
+
+		ok &= Report("erase a word not there", !tree.RemoveWord("car") && !tree.RemoveWord("cab"));
+
+		// The garbage nodes are reclaimed once they are more than the half of the nodes
+		for( uint k=0; k<sizeof(erased_words)/sizeof(erased_words[0]) && !compacted; k++ )
+		{
+			ok &= Report("erase " + TWordType(erased_words[k]), tree.RemoveWord(erased_words[k]) && words.erase(erased_words[k]) == 1);
+			ok &= CheckEdit(tree, words, grid, "  same as a fresh tree", garbage);
+
+			compacted   = (garbage < max_garbage);
+			max_garbage = Max(max_garbage, garbage);
+		}
+
+		ok &= Report("erase until the tree is compacted", compacted && garbage == 0);
+
+		ok &= Report("insert a word after compaction", tree.AddWord("tease") && words.insert("tease").second);
+		ok &= CheckEdit(tree, words, grid, "  same as a fresh tree", garbage);
+
+		// The trees which cannot be edited
+		tree.SaveImage(image_filename);
+		image.Load(TestConfig(image_filename), MIN_WORD_LENGTH, MAX_WORD_LENGTH);
+		dawg.Minimize(true);
+		dawg.Load(TestConfig(dict_filename), MIN_WORD_LENGTH, MAX_WORD_LENGTH);
+		succinct.Succinct(true);
+		succinct.Load(TestConfig(dict_filename), MIN_WORD_LENGTH, MAX_WORD_LENGTH);
+
+		ok &= CheckReadOnly(image, "image");
+		ok &= CheckReadOnly(dawg, "DAWG");
+		ok &= CheckReadOnly(succinct, "succinct tree");
+	}
+	catch( const std::exception & e )
+	{
+		std::cout << "  error: " << e.what() << '\n';
+		ok = false;
+	}
+
+	return (ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,87 @@
+/*
+    Smoggle - A multidimensional and multi-language boggle solver
+    Copyright (C) 2009 - Nicolas Lerm <nicolas.lerme@free.fr>
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <stdexcept>
+#include "test_utils.h"
+
+#define MIN_WORD_LENGTH 2
+#define MAX_WORD_LENGTH 1000
+
+
+//----------------------------------------------------------------------------------------------------------------
+// We check the words stored once a dictionary is loaded with the given normalization, in a plain tree and in a 
+// DAWG (normalized words may come out of order, which a DAWG must handle)
+//----------------------------------------------------------------------------------------------------------------
+bool CheckNormalization( const std::string & dict_filename, const bool case_folding, const std::string & stripped, 
+			 const TWordsList & expected, const std::string & what )
+{
+	CLanguageConfig language_config(TestConfig(dict_filename));
+	CLexicographicTree plain, dawg;
+
+
+	language_config.CaseFolding(case_folding);
+	language_config.StrippedCharacters(stripped);
+
+	plain.Load(language_config, MIN_WORD_LENGTH, MAX_WORD_LENGTH);
+	dawg.Minimize(true);
+	dawg.Load(language_config, MIN_WORD_LENGTH, MAX_WORD_LENGTH);
+
+	return Report(what, StoredWords(plain) == expected && plain.GetNumberOfWords() == expected.size() && 
+			    StoredWords(dawg) == expected && dawg.GetNumberOfWords() == expected.size());
+}
+
+int main()
+{
+	const char* dictionary[]  = { "AOL", "A's", "CAT", "Cat", "as", "cat", "it's", "its", "x" };
+	const char* kept[]        = { "as", "cat", "its" };
+	const char* stripped[]    = { "as", "cat", "its" };
+	const char* folded[]      = { "aol", "as", "cat", "its" };
+	const std::string dict_filename(TEST_TMP_DIR + "dictionary_normalization.txt");
+	CLanguageConfig language_config(TestConfig(dict_filename));
+	CLexicographicTree tree;
+	bool ok(true);
+
+
+	try
+	{
+		SaveDictionary(TWordsList(dictionary, dictionary + sizeof(dictionary)/sizeof(dictionary[0])), dict_filename);
+
+		// Without normalization, the words holding a character out of the alphabet are dropped. Stripping the 
+		// apostrophes gives "its" twice and "As", still dropped. Folding the case too gives "as", "aol" and "cat" 
+		// several times, each stored once.
+		ok &= CheckNormalization(dict_filename, false, "", TWordsList(kept, kept+3), "no normalization drops \"AOL\", \"A's\" and \"it's\"");
+		ok &= CheckNormalization(dict_filename, false, "'", TWordsList(stripped, stripped+3), "stripping \"'\" gives \"it's\" -> \"its\" once");
+		ok &= CheckNormalization(dict_filename, true, "'", TWordsList(folded, folded+4), "folding too gives \"A's\" -> \"as\", \"AOL\" -> \"aol\" once");
+
+		// Words given at runtime are normalized in the same way
+		language_config.CaseFolding(true);
+		language_config.StrippedCharacters("'");
+		tree.Load(language_config, MIN_WORD_LENGTH, MAX_WORD_LENGTH);
+
+		ok &= Report("runtime words are normalized", tree.AddWord("Don't") && !tree.AddWord("DONT") && tree.RemoveWord("C'AT") && 
+							      !tree.RemoveWord("cat") && tree.GetNumberOfWords() == 4 && StoredWords(tree).count("dont") == 1);
+	}
+	catch( const std::exception & e )
+	{
+		std::cout << "  error: " << e.what() << '\n';
+		ok = false;
+	}
+
+	return (ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,89 @@
+/*
+    Smoggle - A multidimensional and multi-language boggle solver
+    Copyright (C) 2009 - Nicolas Lerm <nicolas.lerme@free.fr>
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <set>
+#include <iostream>
+#include "grid.h"
+
+
+//----------------------------------------------------------------------------------------------------------------
+// We check the periodic neighbors of every cell of a grid: they must be distinct, differ from the cell itself and
+// be its wrapped neighbors. On a side of size s, a cell has min(s,3) distinct positions around it, the cell
+// included, so smaller sides give fewer neighbors than the 3^d-1 offsets.
+//----------------------------------------------------------------------------------------------------------------
+bool CheckPeriodicNeighbors( const CCoords & sizes )
+{
+	CGrid grid(sizes.Dim(), 1);
+	uint expected(1);
+	bool ok(true);
+
+
+	grid.Resize(sizes);
+
+	for( uint k=0; k<sizes.Dim(); k++ )
+		expected *= std::min<uint>(sizes[k], 3);
+
+	expected--;
+
+	for( uint cell=0; cell<grid.TotalSize(); cell++ )
+	{
+		const CCoords c(grid.Coords(cell));
+		const CGrid::TCoordsList neighbors(grid.PeriodicNeighbors(c, 1));
+		const CGrid::CAdjacency & adjacency(grid.Adjacency(true));
+		std::set<uint> cells;
+
+
+		for( CGrid::TCoordsListCIt it=neighbors.begin(); it!=neighbors.end(); it++ )
+		{
+			for( uint k=0; k<sizes.Dim(); k++ )
+			{
+				const int d(((*it)[k] - c[k] + sizes[k]) % sizes[k]);
+
+				if( d != 0 && d != 1 && d != sizes[k]-1 )
+					ok = false;
+			}
+
+			if( *it == c || !cells.insert(grid.Offset(*it)).second )
+				ok = false;
+		}
+
+		if( cells.size() != expected || adjacency.offsets[cell+1]-adjacency.offsets[cell] != expected )
+			ok = false;
+	}
+
+	std::cout << "  periodic neighbors of " << sizes << " : " << (ok ? "OK" : "FAILED") << '\n';
+
+	return ok;
+}
+
+int main()
+{
+	bool ok(true);
+
+
+	for( int s=1; s<=4; s++ )
+	{
+		ok &= CheckPeriodicNeighbors(CCoords(uint(1), s));
+
+		for( int t=1; t<=4; t++ )
+			ok &= CheckPeriodicNeighbors(CCoords(s, t));
+	}
+
+	return (ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
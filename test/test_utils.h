@@ -0,0 +1,110 @@
+/*
+    Smoggle - A multidimensional and multi-language boggle solver
+    Copyright (C) 2009 - Nicolas Lerm <nicolas.lerme@free.fr>
+
+    This library is free software; you can redistribute it and/or
+    modify it under the terms of the GNU Lesser General Public
+    License as published by the Free Software Foundation; either
+    version 2.1 of the License, or (at your option) any later version.
+
+    This library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public
+    License along with this library; if not, write to the Free Software
+    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef __TEST_UTILS_H__
+#define __TEST_UTILS_H__
+
+#include <string>
+#include <fstream>
+#include <iostream>
+#include "grid.h"
+#include "lexicographic_tree.h"
+#include "config_file_io_xml.h"
+
+#define TEST_CONFIG_FILENAME std::string("data/config.xml")
+#define TEST_LANGUAGE        std::string("british")
+#define TEST_TMP_DIR         std::string("obj/")
+
+
+typedef CLexicographicTree::TWordsList TWordsList;
+typedef TWordsList::const_iterator     TWordsListCIt;
+
+
+//------------------------------------------------------------------------------------------------------------
+// Helpers shared by the tests, which are run from the root of the project
+//------------------------------------------------------------------------------------------------------------
+
+// We get the config of the test language, reading its words from the given dictionary
+inline CLanguageConfig TestConfig( const std::string & dict_filename )
+{
+	CLanguageConfig language_config;
+	CConfigFileIOXML config_io;
+
+
+	if( !config_io.Load(TEST_CONFIG_FILENAME, TEST_LANGUAGE, language_config) )
+		throw std::logic_error("cannot load " + TEST_CONFIG_FILENAME);
+
+	language_config.DictionaryFilename(dict_filename);
+
+	return language_config;
+}
+
+inline void SaveDictionary( const TWordsList & words, const std::string & dict_filename )
+{
+	std::ofstream fp(dict_filename.c_str());
+
+
+	for( TWordsListCIt it=words.begin(); it!=words.end(); it++ )
+		fp << *it << '\n';
+}
+
+inline TWordsList LoadDictionary( const std::string & dict_filename )
+{
+	std::ifstream fp(dict_filename.c_str());
+	TWordsList words;
+	TWordType word;
+
+
+	while( std::getline(fp, word) )
+		words.insert(word);
+
+	return words;
+}
+
+// We get the words stored in a tree, as written by SaveWords
+inline TWordsList StoredWords( const CLexicographicTree & tree )
+{
+	const std::string dict_filename(TEST_TMP_DIR + "stored_words.txt");
+
+
+	tree.SaveWords(dict_filename);
+
+	return LoadDictionary(dict_filename);
+}
+
+// We fill a grid with one letter per cell, in the order of the offsets
+inline CGrid TestGrid( const uint dim, const uint size, const std::string & letters )
+{
+	CGrid grid(dim, size);
+
+
+	for( uint k=0; k<grid.TotalSize(); k++ )
+		grid.Letter(k, TWordType(1, letters[k % letters.size()]));
+
+	return grid;
+}
+
+inline bool Report( const std::string & what, const bool ok )
+{
+	std::cout << "  " << what << " : " << (ok ? "OK" : "FAILED") << '\n';
+
+	return ok;
+}
+
+#endif //__TEST_UTILS_H__